@@ -90,6 +90,12 @@ public:
      *
      * \note In general, the vectors x and y \em cannot be the same.
      *
+     * \note When the operator acts on only the coarsest level of the patch
+     * hierarchy and D is constant, the action of the operator is computed
+     * while ghost cell values are exchanged between patches, and only the
+     * values in cells adjacent to patch boundaries are recomputed once the
+     * exchange completes.
+     *
      * Upon return from this function, the y vector will contain the result of
      * the application of A to x.
      *
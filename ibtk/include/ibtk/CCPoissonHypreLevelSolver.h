@@ -45,8 +45,12 @@
 #include "Index.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "RefineSchedule.h"
+#include "RobinBcCoefStrategy.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonSolver.h"
+#include "mpi.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -121,8 +125,33 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by PFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ agglomeration_num_ranks = 0    // number of MPI processes onto which level 0 is gathered
+ (0 disables agglomeration)
+ reuse_hypre_setup = FALSE      // retain hypre data structures between calls to
+ initializeSolverState()
  \endverbatim
  *
+ * When \p agglomeration_num_ranks is positive and smaller than the number of
+ * MPI processes, a coarsest-level (level 0) problem is redistributed onto
+ * the first \p agglomeration_num_ranks processes, solved there by \em hypre
+ * using a sub-communicator, and the solution is scattered back to the
+ * original patch distribution.  On coarse levels, each process owns only a
+ * few cells, and the solve is dominated by the latency of the global
+ * reductions performed by \em hypre; agglomeration trades these for one
+ * gather and one scatter per solve.  Agglomeration is only supported for
+ * problems with constant coefficients.
+ *
+ * When \p reuse_hypre_setup is enabled, the hypre grid, matrices, and solvers
+ * are retained by deallocateSolverState().  A subsequent call to
+ * initializeSolverState() reuses them when the patch level, the data depth,
+ * the boundary condition objects, and the constant coefficient \f$D\f$ are
+ * unchanged.  If only the constant coefficient \f$C\f$ has changed (e.g.,
+ * because the time step size has changed), the matrix diagonal is updated in
+ * place and only the hypre solver setup is repeated.  Variable-coefficient
+ * problems are always set up from scratch.  This option assumes that the
+ * Robin coefficients \f$a\f$ and \f$b\f$ provided by the boundary condition
+ * objects do not vary in time.
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A
@@ -283,11 +312,18 @@ private:
      * \brief Functions to allocate, initialize, access, and deallocate hypre
      * data structures.
      */
+    bool hypreSetupIsReusable() const;
+    void cacheHypreSetupConfiguration();
+    void updateMatrixDiagonal(double diagonal_shift);
+    void destroyHypreSetup();
+    void allocateSolverLevel();
+    void deallocateSolverLevel();
     void allocateHypreData();
     void setMatrixCoefficients_aligned();
     void setMatrixCoefficients_nonaligned();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
+    bool solveAgglomeratedSystem(int x_idx, int b_idx);
     void copyToHypre(const std::vector<HYPRE_StructVector>& vectors,
                      const SAMRAI::pdat::CellData<NDIM, double>& src_data,
                      const SAMRAI::hier::Box<NDIM>& box);
@@ -314,6 +350,40 @@ private:
      */
     bool d_grid_aligned_anisotropy;
 
+    /*!
+     * \name Coarse-level agglomeration.
+     *
+     * \note d_solver_level is the patch level on which the hypre data are
+     * defined.  It is d_level unless agglomeration is active, in which case
+     * d_hypre_comm is MPI_COMM_NULL on processes that do not participate in
+     * the hypre solve.
+     */
+    //\{
+    int d_agglomeration_num_ranks;
+    bool d_agglomerate;
+    MPI_Comm d_hypre_comm;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_solver_level;
+    int d_agglomerated_x_idx, d_agglomerated_b_idx;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_gather_sched, d_scatter_sched;
+    //\}
+
+    /*!
+     * \name Configuration for which the retained hypre data structures were
+     * set up.
+     */
+    //\{
+    bool d_reuse_hypre_setup;
+    bool d_hypre_setup_cached;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_cached_hierarchy;
+    int d_cached_level_num;
+    unsigned int d_cached_depth;
+    SAMRAI::hier::IntVector<NDIM> d_cached_ratio;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_cached_boxes;
+    std::vector<int> d_cached_mapping;
+    double d_cached_C, d_cached_D;
+    std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_cached_bc_coefs;
+    //\}
+
     /*!
      * \name hypre objects.
      */
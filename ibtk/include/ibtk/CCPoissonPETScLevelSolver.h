@@ -101,6 +101,7 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ reuse_operator_structure = FALSE // see PETScLevelSolver
  \endverbatim
  *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
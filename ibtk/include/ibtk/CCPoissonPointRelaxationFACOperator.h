@@ -103,12 +103,17 @@ namespace IBTK
  * values): \verbatim
 
  smoother_type = "PATCH_GAUSS_SEIDEL"         // see setSmootherType()
+ chebyshev_lower_eig_factor = 0.1             // see setChebyshevEigenvalueFactors()
+ chebyshev_upper_eig_factor = 1.1             // see setChebyshevEigenvalueFactors()
+ use_single_precision_smoother = FALSE        // see setUseSinglePrecisionSmoother()
  prolongation_method = "LINEAR_REFINE"        // see setProlongationMethod()
  restriction_method = "CONSERVATIVE_COARSEN"  // see setRestrictionMethod()
  coarse_solver_type = "HYPRE_LEVEL_SOLVER"    // see setCoarseSolverType()
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ num_geometric_coarse_levels = 0              // see setNumGeometricCoarseLevels()
+ geometric_coarse_level_min_box_size = 8      // see setGeometricCoarseLevelMinBoxSize()
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -157,9 +162,39 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "L1_JACOBI"
+     * - \c "CHEBYSHEV"
+     *
+     * The Jacobi-type smoothers require only operator applications and update
+     * all degrees of freedom simultaneously.  The Chebyshev smoother uses the
+     * diagonal of the operator as a preconditioner and targets the interval
+     * [lower_eig_factor*lambda_max, upper_eig_factor*lambda_max], in which
+     * lambda_max is an upper bound on the largest eigenvalue of the
+     * diagonally scaled operator that is computed automatically on each level;
+     * the number of smoothing sweeps is the degree of the polynomial.
      */
     void setSmootherType(const std::string& smoother_type);
 
+    /*!
+     * \brief Specify the factors used to determine the eigenvalue interval
+     * targeted by the Chebyshev smoother.
+     */
+    void setChebyshevEigenvalueFactors(double lower_eig_factor, double upper_eig_factor);
+
+    /*!
+     * \brief Specify whether to smooth the error in single precision.
+     *
+     * When enabled, smoothError() converts the error and residual to
+     * single-precision scratch data on entry, performs all of the smoothing
+     * sweeps on that data, and converts the error back to double precision on
+     * exit.  Between sweeps, only the cells near the patch boundaries are
+     * exchanged with the double-precision error to refill ghost cells.
+     * Residual evaluation, restriction, prolongation, and the coarse level
+     * solver continue to use double precision, so the outer Krylov method is
+     * unaffected apart from the accuracy of the preconditioner.
+     */
+    void setUseSinglePrecisionSmoother(bool use_single_precision_smoother);
+
     /*!
      * \brief Specify the coarse level solver.
      */
@@ -270,10 +305,23 @@ private:
     SAMRAI::tbox::Pointer<PoissonSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Parameters for Chebyshev smoothing, and the upper bounds on the largest
+     * eigenvalue of the diagonally scaled operator on each level.
+     */
+    double d_chebyshev_lower_eig_factor, d_chebyshev_upper_eig_factor;
+    std::vector<double> d_chebyshev_max_eig;
+
+    /*
+     * Single-precision smoothing parameters and scratch data.
+     */
+    bool d_use_single_precision_smoother;
+    int d_error_sp_idx, d_residual_sp_idx, d_update_sp_idx;
+
     /*
      * Patch overlap data.
      */
-    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap, d_patch_interior_bdry_boxes;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
 };
 } // namespace IBTK
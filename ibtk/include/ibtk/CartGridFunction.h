@@ -128,6 +128,17 @@ public:
 
     //\}
 
+    /*!
+     * \brief Reset any data cached by the function object that depends on the
+     * configuration of the specified levels of the patch hierarchy.
+     *
+     * \note The default implementation is empty.  Owners of CartGridFunction
+     * objects should call this function following regridding.
+     */
+    virtual void resetHierarchyConfiguration(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                             int coarsest_ln,
+                                             int finest_ln);
+
 protected:
     /*
      * The object name is used for error/warning reporting.
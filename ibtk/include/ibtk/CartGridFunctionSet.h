@@ -135,6 +135,14 @@ public:
 
     //\}
 
+    /*!
+     * \brief Reset the hierarchy configuration of all of the component
+     * function objects.
+     */
+    void resetHierarchyConfiguration(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                     int coarsest_ln,
+                                     int finest_ln);
+
 protected:
     /*
      * The collection of function objects.
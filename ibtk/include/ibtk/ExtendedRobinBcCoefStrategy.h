@@ -82,6 +82,29 @@ public:
      */
     virtual void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Indicate whether the coefficients set by setBcCoefs() depend only
+     * on the location of the boundary, the fill time, and whether homogeneous
+     * boundary conditions are being set.
+     *
+     * When this function returns true, callers may cache the coefficients and
+     * reuse them for repeated boundary fills.  Strategies whose coefficients
+     * depend on patch data values (e.g., via the target data index) must not
+     * return true.
+     *
+     * The default implementation returns false.
+     */
+    virtual bool getBcCoefsAreCacheable() const;
+
+    /*!
+     * \brief Indicate whether the coefficients set by setBcCoefs() are
+     * independent of the fill time.  This is only used when
+     * getBcCoefsAreCacheable() returns true.
+     *
+     * The default implementation returns false.
+     */
+    virtual bool getBcCoefsAreTimeIndependent() const;
+
     //\}
 
 protected:
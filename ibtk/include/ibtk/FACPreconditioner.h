@@ -74,6 +74,13 @@ namespace IBTK
  * stand-alone solver; rather, it is intended to be used in conjunction with an
  * iterative Krylov method.
  *
+ * \note The FACPreconditionerStrategy interface, the SAMRAI hierarchy data
+ * operations used to manipulate the multilevel vectors, and the coarse level
+ * solvers (hypre and PETSc) are all defined in terms of double-precision data.
+ * Strategies may nonetheless perform their smoothing sweeps on
+ * single-precision copies of the error and residual; see
+ * CCPoissonPointRelaxationFACOperator::setUseSinglePrecisionSmoother().
+ *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
 
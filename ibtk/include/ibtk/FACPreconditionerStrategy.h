@@ -46,6 +46,11 @@
 
 namespace SAMRAI
 {
+namespace hier
+{
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
 namespace solv
 {
 template <int DIM, class TYPE>
@@ -53,6 +58,11 @@ class SAMRAIVectorReal;
 } // namespace solv
 } // namespace SAMRAI
 
+namespace IBTK
+{
+class GeneralSolver;
+} // namespace IBTK
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBTK
@@ -137,6 +147,34 @@ public:
      */
     virtual double getDt() const;
 
+    /*!
+     * \brief Set the number of purely geometric coarse levels to construct
+     * below level 0 for the coarse level solve.
+     *
+     * When this number is positive and the coarsest level of the hierarchy is
+     * level 0, the coarse level solver is applied to an auxiliary hierarchy
+     * consisting of level 0 and its geometric coarsenings; see
+     * initializeGeometricCoarseLevels().  The coarse level solver must
+     * therefore be a multilevel solver such as an FACPreconditioner.
+     *
+     * \note This function must be called before the operator state is
+     * initialized.
+     */
+    void setNumGeometricCoarseLevels(int num_geometric_coarse_levels);
+
+    /*!
+     * \brief Set the minimum width, in cells, of the boxes on the geometric
+     * coarse levels.
+     *
+     * Geometric coarse levels whose coarsened level-0 boxes would be narrower
+     * than this are instead built by re-boxing the coarsened physical domain
+     * into boxes of this size, which are distributed over fewer processors.
+     *
+     * \note This function must be called before the operator state is
+     * initialized.
+     */
+    void setGeometricCoarseLevelMinBoxSize(int min_box_size);
+
     /*!
      * \brief Zero-out the provided vector on the specified level of the patch
      * hierarchy.
@@ -250,6 +288,55 @@ protected:
     virtual SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> >
     getLevelSAMRAIVectorReal(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& vec, int level_num) const;
 
+    /*!
+     * \brief Build an auxiliary patch hierarchy consisting of the coarsest
+     * level of the hierarchy of \a solution along with up to \a
+     * num_coarse_levels purely geometric coarsenings of that level, and
+     * allocate solution and right-hand side vectors on the auxiliary hierarchy.
+     *
+     * The finest level of the auxiliary hierarchy has the same boxes and
+     * processor mapping as level \a level_num, which must be level 0.  Each
+     * coarser level is obtained by coarsening those boxes by a factor of two
+     * until they would become narrower than the minimum box size.  Below that,
+     * the coarsened physical domain is re-boxed into boxes of the minimum box
+     * size that are assigned round-robin to no more processors than there are
+     * boxes.  Fewer levels are built if the physical domain cannot be coarsened
+     * further.
+     *
+     * An error is raised unless \a coarse_solver is an FACPreconditioner and
+     * \a coefs_are_constant is true, because the nested operator evaluates the
+     * problem coefficients on the auxiliary hierarchy.
+     *
+     * \return The number of geometric coarse levels that were built.
+     */
+    int initializeGeometricCoarseLevels(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                                        const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs,
+                                        int level_num,
+                                        int num_coarse_levels,
+                                        const GeneralSolver* coarse_solver,
+                                        bool coefs_are_constant);
+
+    /*!
+     * \brief Copy the error and residual on level \a level_num to the finest
+     * level of the auxiliary hierarchy built by
+     * initializeGeometricCoarseLevels().
+     */
+    void copyToGeometricCoarseLevels(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error,
+                                     const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual,
+                                     int level_num);
+
+    /*!
+     * \brief Copy the error on the finest level of the auxiliary hierarchy
+     * built by initializeGeometricCoarseLevels() back to level \a level_num.
+     */
+    void copyFromGeometricCoarseLevels(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& error, int level_num);
+
+    /*!
+     * \brief Deallocate the auxiliary hierarchy built by
+     * initializeGeometricCoarseLevels().
+     */
+    void deallocateGeometricCoarseLevels();
+
     // Pointer to the FACPreconditioner that is using this operator.
     SAMRAI::tbox::ConstPointer<IBTK::FACPreconditioner> d_preconditioner;
 
@@ -264,6 +351,14 @@ protected:
     bool d_homogeneous_bc;
     double d_solution_time, d_current_time, d_new_time;
 
+    // Requested number of geometric coarse levels below level 0, the minimum
+    // box width on those levels, and the auxiliary hierarchy and vectors on
+    // which the coarse problem is solved when these levels are used.
+    int d_num_geometric_coarse_levels, d_geometric_coarse_level_min_box_size;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_geometric_coarse_hierarchy;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_geometric_coarse_solution,
+        d_geometric_coarse_rhs;
+
 private:
     /*!
      * \brief Default constructor.
@@ -299,9 +299,26 @@ public:
 
     /*!
      * \brief Reinitialize the mappings from elements to Cartesian grid patches.
+     *
+     * \note If a positive displacement threshold has been set via
+     * setElementMappingDisplacementThreshold(), the existing mappings are
+     * reused when the patch level in which the FE mesh is embedded has not
+     * changed and no node has moved farther than the threshold since the
+     * mappings were last computed.  In this case, the mappings are computed
+     * using the ghost cell width grown by the threshold (rounded up to a whole
+     * number of cells).
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Set the maximum nodal displacement, measured as a fraction of the
+     * minimum Cartesian grid spacing on the level in which the FE mesh is
+     * embedded, below which reinitElementMappings() reuses the existing element
+     * mappings.  A nonpositive value (the default) means that the mappings are
+     * always recomputed.
+     */
+    void setElementMappingDisplacementThreshold(double threshold);
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -426,6 +443,31 @@ public:
                       const std::string& system_name,
                       bool use_consistent_mass_matrix = true);
 
+    /*!
+     * \brief Set the method used by computeL2Projection() to solve linear
+     * systems involving the consistent mass matrix.  Supported values are:
+     *
+     *  - "DEFAULT": use the libMesh solver defaults, which may be overridden
+     *    from the command line (the default)
+     *  - "CHOLESKY": use CG preconditioned by a Cholesky factorization of the
+     *    mass matrix (or, in parallel, of its processor-local diagonal blocks)
+     *    that is computed once and reused by every subsequent projection
+     *  - "LUMPED_MASS": use CG preconditioned by the diagonal mass matrix
+     *    provided by buildDiagonalL2MassMatrix(), starting from the lumped-mass
+     *    projection as the initial guess
+     *
+     * \note Any cached L2 projection solvers are discarded when the solver
+     * type is changed.
+     */
+    void setL2ProjectionSolverType(const std::string& solver_type);
+
+    /*!
+     * \return The number of iterations performed by the most recent consistent
+     * mass matrix solve for the specified system, or zero if no such solve has
+     * been performed.
+     */
+    int getL2ProjectionIterations(const std::string& system_name) const;
+
     /*!
      * \return Pointers to a linear solver and sparse matrix corresponding to a
      * L2 projection operator.
@@ -647,6 +689,24 @@ private:
      */
     std::vector<std::pair<Point, Point> >* computeActiveElementBoundingBoxes();
 
+    /*!
+     * Update the uniform bin grid over the active element bounding boxes.  The
+     * bin grid is rebuilt only when the number of elements changes or when the
+     * mesh leaves the (padded) extents of the grid, and the binned element
+     * lists are regenerated only when some element's bounding box has moved to
+     * a different range of bins.
+     *
+     * \note This method assumes that computeActiveElementBoundingBoxes() has
+     * already been called.
+     */
+    void updateElementBins();
+
+    /*!
+     * Determine whether the element mappings computed by the previous call to
+     * reinitElementMappings() remain valid.
+     */
+    bool elementMappingsAreValid();
+
     /*!
      * Collect all of the active elements which are located within a local
      * Cartesian grid patch grown by the specified ghost cell width.
@@ -754,6 +814,24 @@ private:
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
 
+    /*
+     * Uniform bin grid over the active element bounding boxes, along with the
+     * range of bins occupied by each element.  The elements in each bin are
+     * stored in compressed sparse row format.
+     */
+    double d_elem_bin_x_lower[NDIM], d_elem_bin_x_upper[NDIM], d_elem_bin_width[NDIM];
+    int d_elem_bin_num[NDIM];
+    std::vector<int> d_elem_bin_offsets;
+    std::vector<libMesh::Elem*> d_elem_bin_elems;
+    std::vector<int> d_elem_bin_range;
+
+    /*
+     * Data used to determine whether the element mappings may be reused.
+     */
+    double d_remap_displacement_threshold;
+    libMesh::NumericVector<double>* d_X_mapping_vec;
+    std::vector<int> d_mapping_level_signature;
+
     /*
      * Ghost vectors for the various equation systems.
      */
@@ -768,6 +846,8 @@ private:
     std::map<std::string, libMesh::NumericVector<double>*> d_L2_proj_matrix_diag;
     std::map<std::string, libMesh::QuadratureType> d_L2_proj_quad_type;
     std::map<std::string, libMesh::Order> d_L2_proj_quad_order;
+    std::string d_L2_proj_solver_type;
+    std::map<std::string, int> d_L2_proj_iterations;
 };
 } // namespace IBTK
 
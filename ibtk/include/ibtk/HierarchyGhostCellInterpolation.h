@@ -64,6 +64,10 @@ namespace solv
 template <int DIM>
 class RobinBcCoefStrategy;
 } // namespace solv
+namespace tbox
+{
+class Schedule;
+} // namespace tbox
 namespace xfer
 {
 template <int DIM>
@@ -291,6 +295,19 @@ public:
      */
     void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Specify whether fillDataBegin() and fillDataEnd() should overlap
+     * the same-level ghost cell exchange with computation when possible.
+     *
+     * This is only useful for callers that compute values in patch interiors
+     * between fillDataBegin() and fillDataEnd().  By default, the overlapped
+     * exchange is not used, and ghost cells are filled by SAMRAI refine
+     * schedules.
+     *
+     * \see fillDataOverlapsCommunication()
+     */
+    void setOverlapCommunication(bool overlap_communication);
+
     /*!
      * \brief Setup the hierarchy ghost cell interpolation operator to perform
      * the specified interpolation transactions on the specified patch
@@ -337,6 +354,47 @@ public:
      */
     void fillData(double fill_time);
 
+    /*!
+     * \brief Begin filling coarse-fine boundary and physical boundary ghost
+     * cells on all levels of the patch hierarchy.
+     *
+     * When fillDataOverlapsCommunication() returns true, this function only
+     * posts the nonblocking sends and receives of the same-level ghost cell
+     * exchange, and the caller may compute values in patch interiors (i.e.,
+     * values whose stencils do not reach ghost cells) before calling
+     * fillDataEnd().  Otherwise, this function performs all data
+     * synchronization and inter-patch and inter-level data transfers, and
+     * only ghost cell values at physical boundaries are deferred to
+     * fillDataEnd().
+     *
+     * \note Each call to fillDataBegin() must be matched by a call to
+     * fillDataEnd() before the operator state is modified or fillData() is
+     * called.
+     *
+     * \see fillDataEnd()
+     */
+    void fillDataBegin(double fill_time);
+
+    /*!
+     * \brief Complete the ghost cell fill started by fillDataBegin() by
+     * waiting for any outstanding ghost cell exchange and setting ghost cell
+     * values at physical boundaries.
+     */
+    void fillDataEnd();
+
+    /*!
+     * \brief Indicate whether fillDataBegin() returns before the ghost cell
+     * exchange has completed.
+     *
+     * This is presently the case when overlapping communication has been
+     * requested via setOverlapCommunication(), the operator acts on only the
+     * coarsest level of the patch hierarchy, and each transaction component
+     * uses the same source and destination patch data indices.  In all other cases,
+     * ghost cell values at coarse-fine interfaces and patch boundaries are set
+     * by fillDataBegin().
+     */
+    bool fillDataOverlapsCommunication() const;
+
 protected:
 private:
     /*!
@@ -359,6 +417,15 @@ private:
      */
     HierarchyGhostCellInterpolation& operator=(const HierarchyGhostCellInterpolation& that);
 
+    /*!
+     * \brief Setup or clear the cached same-level ghost cell exchange used by
+     * fillDataBegin() and fillDataEnd().
+     *
+     * The cached schedule is reused when it already covers the ghost cell
+     * widths of the current transaction components.
+     */
+    void setupHaloSchedule();
+
     // Boolean indicating whether the operator is initialized.
     bool d_is_initialized;
 
@@ -366,6 +433,10 @@ private:
     // boundary conditions (when applicable).
     bool d_homogeneous_bc;
 
+    // Data describing a split-phase fill that is in progress.
+    bool d_fill_in_progress;
+    double d_fill_time;
+
     // The component interpolation operations to perform.
     std::vector<InterpolationTransactionComponent> d_transaction_comps;
 
@@ -383,6 +454,13 @@ private:
     SAMRAI::xfer::RefinePatchStrategy<NDIM>* d_refine_strategy;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
 
+    // Cached same-level ghost cell exchange that is split between
+    // fillDataBegin() and fillDataEnd() when requested, along with the ghost
+    // cell width used to determine neighboring patches.
+    bool d_overlap_communication;
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Schedule> d_halo_sched;
+    SAMRAI::hier::IntVector<NDIM> d_halo_ghost_width;
+
     // Cached coarse-fine boundary and physical boundary condition handlers.
     std::vector<SAMRAI::tbox::Pointer<CoarseFineBoundaryRefinePatchStrategy> > d_cf_bdry_ops;
     std::vector<SAMRAI::tbox::Pointer<CartExtrapPhysBdryOp> > d_extrap_bc_ops;
@@ -1149,6 +1149,44 @@ public:
                           int src_idx,
                           SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeVariable<NDIM, double> > src_var);
 
+    //\}
+
+    //\{ \name Compound mathematical operations.
+
+    /*!
+     * \brief Compute the cell-centered divergence of a side-centered normal
+     * vector field using centered differences, along with the norms of the
+     * result.
+     *
+     * Sets dst = alpha div src1 + beta src2 and computes the discrete L1, L2,
+     * and max norms of dst, weighted by the cell weights.  This is equivalent
+     * to calling div() followed by the L1Norm(), L2Norm(), and maxNorm()
+     * methods of SAMRAI::math::HierarchyCellDataOpsReal, except that the norms
+     * are accumulated while computing the divergence on each patch, and only
+     * two global reductions are performed.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void divWithNorms(int dst_idx,
+                      SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > dst_var,
+                      double alpha,
+                      int src1_idx,
+                      SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src1_var,
+                      SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src1_ghost_fill,
+                      double src1_ghost_fill_time,
+                      bool src1_cf_bdry_synch,
+                      double& dst_l1_norm,
+                      double& dst_l2_norm,
+                      double& dst_max_norm,
+                      double beta = 0.0,
+                      int src2_idx = -1,
+                      SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src2_var = NULL,
+                      int dst_depth = 0,
+                      int src2_depth = 0);
+
+    //\}
+
 private:
     /*!
      * \brief Default constructor.
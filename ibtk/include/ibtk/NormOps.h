@@ -43,6 +43,8 @@ class SAMRAIVectorReal;
 } // namespace SAMRAI
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBTK
@@ -50,6 +52,13 @@ namespace IBTK
 /*!
  * \brief Class NormOps provides functionality for computing discrete vector
  * norms.
+ *
+ * The L1 and L2 norms are computed by summing per-patch contributions exactly
+ * in a fixed-point accumulator that is reduced across processes by a single
+ * constant-size reduction.  Consequently, the computed norms do not depend on
+ * the order in which contributions are accumulated, i.e., they do not depend
+ * on the number of processes or the distribution of the patches among them,
+ * provided that the patch configuration itself is unchanged.
  */
 class NormOps
 {
@@ -69,6 +78,25 @@ public:
      */
     static double maxNorm(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector, bool local_only = false);
 
+    /*!
+     * \brief Compute the sum of the values over all processes.
+     *
+     * The sum is computed exactly and then rounded, so that the result is
+     * independent of the order of the values and of their distribution among
+     * the processes.
+     */
+    static double reproducibleSum(const std::vector<double>& local_vals, bool local_only = false);
+
+    /*!
+     * \brief Compute the sums of several collections of values over all
+     * processes using a single reduction.
+     *
+     * Upon return, \a sums[i] contains the reproducible sum of \a local_vals[i]
+     * over all processes.
+     */
+    static void
+    reproducibleSum(const std::vector<std::vector<double> >& local_vals, double* sums, bool local_only = false);
+
 protected:
 private:
     /*!
@@ -99,14 +127,17 @@ private:
     NormOps& operator=(const NormOps& that);
 
     /*!
-     * \brief Compute the local L1 norm.
+     * \brief Collect the local per-patch contributions to the L1 norm.
      */
-    static double L1Norm_local(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector);
+    static void getL1NormPatchContributions(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector,
+                                            std::vector<double>& L1_norm_patch);
 
     /*!
-     * \brief Compute the local L2 norm.
+     * \brief Collect the local per-patch contributions to the square of the L2
+     * norm.
      */
-    static double L2Norm_local(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector);
+    static void getL2NormSquaredPatchContributions(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector,
+                                                   std::vector<double>& L2_norm_squared_patch);
 };
 } // namespace IBTK
 
@@ -36,6 +36,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <deque>
 #include <iosfwd>
 #include <string>
 #include <vector>
@@ -99,7 +100,13 @@ namespace IBTK
  *   is provided to the class constructor, memory management of that object is
  *   \em NOT handled by the PETScKrylovLinearSolver.  In particular, it is the
  *   caller's responsibility to ensure that the supplied KSP object is properly
- *   destroyed via KSPDestroy().
+ *   destroyed via KSPDestroy().  \par
+ * - Pipelined Krylov methods (e.g., ksp_type = "pipecg", "pipecr", "pgmres",
+ *   or "pipegcr") are supported.  PETScSAMRAIVectorReal provides the local
+ *   parts of the inner products and norms required by PETSc's split-phase
+ *   reduction interface (VecDotBegin()/VecDotEnd(), etc.), so that the global
+ *   reductions can overlap with operator and preconditioner applications
+ *   when PETSc is configured with nonblocking MPI reductions.
  *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
@@ -111,8 +118,29 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ num_extrapolation_vecs = 0    // number of previous solutions used to
+                               // extrapolate the initial guess
+ num_recycled_vecs = 0         // maximum number of previous solutions used to
+                               // project the initial guess
  \endverbatim
  *
+ * When \p num_extrapolation_vecs is positive, the initial guess is replaced by
+ * a polynomial extrapolation of the most recent solutions (e.g., \f$ x^{n} \f$
+ * for one vector and \f$ 2 x^{n} - x^{n-1} \f$ for two vectors).
+ *
+ * When \p num_recycled_vecs is positive, the solver also retains a basis
+ * \f$ X \f$ of previous solutions for which the vectors \f$ A X \f$ are
+ * orthonormal.  Before each solve, the initial guess \f$ x_0 \f$ is corrected
+ * by the projection \f$ x_0 + X (A X)^T (b - A x_0) \f$, which minimizes the
+ * initial residual over the recycled subspace.  This requires up to two
+ * additional operator applications per solve.
+ *
+ * Only the solutions of solves that converge are retained, and previous
+ * solutions are discarded whenever the solver state is deallocated, e.g.,
+ * following regridding.  When logging is enabled, the number of iterations and
+ * the wall-clock time of each solve are reported along with running averages
+ * over all solves performed by the solver.
+ *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
  * Argonne National Laboratory (ANL).  For more information about PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -382,6 +410,25 @@ private:
      */
     void deallocateNullspaceData();
 
+    /*!
+     * \brief Replace or correct the initial guess using previously computed
+     * solutions.
+     *
+     * \return \p true if the initial guess was modified.
+     */
+    bool computeInitialGuess(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, bool initial_guess_nonzero);
+
+    /*!
+     * \brief Record a newly computed solution for use in constructing
+     * subsequent initial guesses.
+     */
+    void updateSolutionHistory(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
+    /*!
+     * \brief Discard all previously computed solutions.
+     */
+    void deallocateSolutionHistory();
+
     /*!
      * \name Static functions for use by PETSc KSP and MatShell objects.
      */
@@ -419,6 +466,28 @@ private:
     Vec d_petsc_nullspace_constant_vec;
     std::vector<Vec> d_petsc_nullspace_basis_vecs;
     bool d_solver_has_attached_nullspace;
+
+    /*!
+     * \brief Previously computed solutions used to construct initial guesses.
+     *
+     * Extrapolation vectors are ordered from most to least recent.  The
+     * recycled vectors are stored along with their images under the linear
+     * operator.
+     */
+    //\{
+    int d_num_extrapolation_vecs, d_num_recycled_vecs;
+    std::deque<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_extrapolation_vecs;
+    std::deque<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_recycled_vecs,
+        d_recycled_op_vecs;
+    //\}
+
+    /*!
+     * \brief Solver statistics.
+     */
+    //\{
+    int d_num_solves, d_total_iterations;
+    double d_total_solve_time;
+    //\}
 };
 } // namespace IBTK
 
@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "CoarseFineBoundary.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
@@ -80,8 +81,16 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ reuse_operator_structure = FALSE // retain the level operator between calls to
+                                  // deallocateSolverState() and
+                                  // initializeSolverState()
  \endverbatim
  *
+ * When \p reuse_operator_structure is enabled and the solver is reinitialized
+ * on a patch level with the same boxes and processor mapping, only the values
+ * of the PETSc level operator are reset; its nonzero structure and parallel
+ * communication pattern are reused.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -299,6 +308,12 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
     SAMRAI::tbox::Pointer<SAMRAI::hier::CoarseFineBoundary<NDIM> > d_cf_boundary;
 
+    /*!
+     * \brief Whether to reuse the nonzero structure of the level operator when
+     * the solver is reinitialized on an unchanged patch level.
+     */
+    bool d_reuse_operator_structure;
+
     /*!
      * \name PETSc objects.
      */
@@ -334,6 +349,18 @@ protected:
     //\}
 
 private:
+    /*!
+     * \brief Determine whether the retained level operator was constructed for
+     * the current patch level.
+     */
+    bool levelOperatorIsReusable() const;
+
+    /*!
+     * \brief Record the configuration of the patch level for which the level
+     * operator was constructed.
+     */
+    void cacheLevelOperatorConfiguration();
+
     /*!
      * \brief Copy constructor.
      *
@@ -368,6 +395,17 @@ private:
      * \brief Apply the preconditioner to \a x and store the result in \a y.
      */
     static PetscErrorCode PCApply_RedBlackMultiplicative(PC pc, Vec x, Vec y);
+
+    /*!
+     * \brief Configuration of the patch level for which the retained level
+     * operator was constructed.
+     */
+    //\{
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_cached_hierarchy;
+    int d_cached_level_num;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_cached_boxes;
+    std::vector<int> d_cached_mapping;
+    //\}
 };
 } // namespace IBTK
 
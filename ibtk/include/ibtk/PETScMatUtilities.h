@@ -81,6 +81,12 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * cell-centered Laplacian of a cell-centered variable restricted to a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * \note If \a reuse_nonzero_structure is true and \a mat was previously
+     * constructed by this routine for a patch level with the same DOF
+     * indexing, only the values of the matrix are reset, and the existing
+     * nonzero structure and parallel communication pattern of \a mat are
+     * reused.  Otherwise, \a mat is destroyed and rebuilt.
      */
     static void constructPatchLevelCCLaplaceOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
@@ -88,12 +94,15 @@ public:
                                                double data_time,
                                                const std::vector<int>& num_dofs_per_proc,
                                                int dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * cell-centered Laplacian of a cell-centered variable restricted to a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * \see reusePatchLevelMatStructure()
      */
     static void constructPatchLevelCCLaplaceOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
@@ -101,12 +110,15 @@ public:
                                                double data_time,
                                                const std::vector<int>& num_dofs_per_proc,
                                                int dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered Laplacian of a side-centered variable restricted to a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * \see reusePatchLevelMatStructure()
      */
     static void constructPatchLevelSCLaplaceOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
@@ -114,7 +126,26 @@ public:
                                                double data_time,
                                                const std::vector<int>& num_dofs_per_proc,
                                                int dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
+
+    /*!
+     * \brief Determine whether the nonzero structure of an existing parallel
+     * PETSc Mat object may be reused when resetting the values of a patch level
+     * operator.
+     *
+     * The nonzero structure is reusable if \a reuse_nonzero_structure is true,
+     * \a mat is non-NULL, and the parallel layout of \a mat matches that
+     * specified by \a num_dofs_per_proc on all MPI processes.  In this case,
+     * \a mat is configured to generate an error if a new nonzero location is
+     * inserted.  Otherwise, \a mat is destroyed (if non-NULL).
+     *
+     * \note It is the responsibility of the caller to ensure that the DOF
+     * indexing of the patch level is unchanged since \a mat was constructed.
+     */
+    static bool reusePatchLevelMatStructure(Mat& mat,
+                                            const std::vector<int>& num_dofs_per_proc,
+                                            bool reuse_nonzero_structure);
 
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
@@ -66,6 +66,11 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * The local (i.e., unreduced) inner product and norm operations required by
+ * PETSc's split-phase reduction interface (e.g., VecDotBegin()/VecDotEnd() and
+ * VecMDotBegin()/VecMDotEnd()) are also provided, so that pipelined Krylov
+ * methods may overlap global reductions with other work.
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
@@ -140,6 +145,18 @@ public:
     replaceSAMRAIVector(Vec petsc_vec,
                         SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, PetscScalar> > samrai_vec);
 
+    /*!
+     * Enable or disable reproducible global inner products.  When enabled, the
+     * inner products computed by VecDot(), VecTDot(), VecMDot(), VecMTDot(),
+     * and VecDotNorm2() sum their per-patch contributions exactly via
+     * NormOps::reproducibleSum(), so that their values do not depend on the
+     * number of processes.  Reproducible reductions are disabled by default.
+     *
+     * \note The split-phase (local) inner products are reduced by PETSc and
+     * are not affected by this setting.
+     */
+    static void setUseReproducibleReductions(bool use_reproducible_reductions);
+
 protected:
     /*
      * Constructor for PETScSAMRAIVectorReal is protected so that an object of
@@ -270,6 +287,11 @@ private:
      */
     Vec d_petsc_vector;
     bool d_vector_created_via_duplicate, d_vector_checked_out_read_write, d_vector_checked_out_read;
+
+    /*
+     * Whether global inner products are computed reproducibly.
+     */
+    static bool s_use_reproducible_reductions;
 };
 } // namespace IBTK
 
@@ -643,6 +643,39 @@ public:
 
     //\}
 
+    /*!
+     * \name Compound mathematical operations.
+     *
+     * These operations combine several of the basic operations above into a
+     * single sweep over the patch, so that the patch data are read from memory
+     * only once.
+     */
+    //\{
+
+    /*!
+     * \brief Computes dst_l = alpha div src1 + beta src2_m and accumulates the
+     * norms of dst_l.
+     *
+     * Uses centered differences.  The weighted L1 norm and the square of the
+     * weighted L2 norm of dst_l are \em added to l1_norm and l2_norm_sq, and
+     * max_norm is set to the maximum of its input value and the max norm of
+     * dst_l.  Only cells with positive weight contribute to the norms.
+     */
+    void divWithNorms(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst,
+                      double alpha,
+                      SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src1,
+                      double beta,
+                      SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src2,
+                      SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > wgt,
+                      SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                      double& l1_norm,
+                      double& l2_norm_sq,
+                      double& max_norm,
+                      int l = 0,
+                      int m = 0) const;
+
+    //\}
+
 private:
     /*!
      * \brief Copy constructor.
@@ -108,6 +108,8 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10            // see setCoarseSolverMaxIterations()
+ num_geometric_coarse_levels = 0              // see setNumGeometricCoarseLevels()
+ geometric_coarse_level_min_box_size = 8      // see setGeometricCoarseLevelMinBoxSize()
  \endverbatim
 */
 class PoissonFACPreconditionerStrategy : public FACPreconditionerStrategy
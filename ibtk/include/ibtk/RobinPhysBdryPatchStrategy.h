@@ -35,20 +35,27 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <set>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
+#include "tbox/Pointer.h"
 
 namespace SAMRAI
 {
 namespace hier
 {
 template <int DIM>
+class BoundaryBox;
+template <int DIM>
 class Patch;
+template <int DIM>
+class Variable;
 } // namespace hier
 namespace solv
 {
@@ -126,6 +133,32 @@ public:
      */
     bool getHomogeneousBc() const;
 
+    /*!
+     * \brief Clear any cached boundary condition coefficients.
+     *
+     * \see computeBcCoefs()
+     */
+    void clearBcCoefCache();
+
+    /*!
+     * \brief Indicate whether the coefficients set by \a bc_coef depend only on
+     * the location of the boundary, the fill time, and whether homogeneous
+     * boundary conditions are being set, so that they may be cached.
+     *
+     * This is the case for muParserRobinBcCoefs objects and for
+     * ExtendedRobinBcCoefStrategy objects whose
+     * ExtendedRobinBcCoefStrategy::getBcCoefsAreCacheable() returns true.
+     */
+    static bool getBcCoefsAreCacheable(const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef);
+
+    /*!
+     * \brief Indicate whether the coefficients set by \a bc_coef are both
+     * cacheable and independent of the fill time.
+     *
+     * \see getBcCoefsAreCacheable()
+     */
+    static bool getBcCoefsAreTimeIndependent(const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef);
+
     /*!
      * \name Partial implementation of SAMRAI::xfer::RefinePatchStrategy
      * interface.
@@ -203,6 +236,31 @@ public:
                                                     const SAMRAI::hier::IntVector<NDIM>& ghost_width_to_fill);
 
 protected:
+    /*!
+     * \brief Compute the Robin boundary condition coefficients on the specified
+     * boundary box.
+     *
+     * Upon return, \a acoef_data, \a bcoef_data, and \a gcoef_data point to
+     * arrays defined on \a bc_coef_box.  These arrays should be treated as
+     * read-only.  Homogeneous boundary conditions are applied according to the
+     * current value of d_homogeneous_bc.
+     *
+     * Coefficients provided by cacheable strategy objects (see
+     * getBcCoefsAreCacheable()) are cached and are reused by subsequent fills
+     * on the same boundary box at the same time (or at any time, for
+     * time-independent coefficients).
+     */
+    void computeBcCoefs(SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& acoef_data,
+                        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& bcoef_data,
+                        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& gcoef_data,
+                        SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef,
+                        int target_data_idx,
+                        const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >& var,
+                        const SAMRAI::hier::Patch<NDIM>& patch,
+                        const SAMRAI::hier::BoundaryBox<NDIM>& bdry_box,
+                        const SAMRAI::hier::Box<NDIM>& bc_coef_box,
+                        double fill_time);
+
     /*
      * The patch data indices corresponding to the "scratch" patch data that
      * requires extrapolation of ghost cell values at physical boundaries.
@@ -239,6 +297,30 @@ private:
      * \return A reference to this object.
      */
     RobinPhysBdryPatchStrategy& operator=(const RobinPhysBdryPatchStrategy& that);
+
+    /*
+     * Cached boundary condition coefficients, indexed by the strategy object,
+     * the location and extents of the boundary box, the patch geometry, and
+     * whether homogeneous boundary conditions are being set.
+     */
+    struct BcCoefCacheKey
+    {
+        bool operator<(const BcCoefCacheKey& that) const;
+
+        const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef;
+        int location_index;
+        SAMRAI::hier::Box<NDIM> bc_coef_box, patch_box;
+        double x_lower[NDIM], dx[NDIM];
+        bool homogeneous_bc;
+    };
+
+    struct BcCoefCacheEntry
+    {
+        double fill_time;
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> > acoef_data, bcoef_data, gcoef_data;
+    };
+
+    std::map<BcCoefCacheKey, BcCoefCacheEntry> d_bc_coef_cache;
 };
 } // namespace IBTK
 
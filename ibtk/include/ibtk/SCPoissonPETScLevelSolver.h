@@ -100,6 +100,7 @@ namespace IBTK
  solvers)
  rel_residual_tol = 1.0e-6      // see setRelativeTolerance()
  enable_logging = FALSE         // see setLoggingEnabled()
+ reuse_operator_structure = FALSE // see PETScLevelSolver
  options_prefix = ""            // see setOptionsPrefix()
  \endverbatim
  *
@@ -100,12 +100,16 @@ namespace IBTK
  * values): \verbatim
 
  smoother_type = "PATCH_GAUSS_SEIDEL"         // see setSmootherType()
+ chebyshev_lower_eig_factor = 0.1             // see setChebyshevEigenvalueFactors()
+ chebyshev_upper_eig_factor = 1.1             // see setChebyshevEigenvalueFactors()
  prolongation_method = "CONSTANT_REFINE"      // see setProlongationMethod()
  restriction_method = "CONSERVATIVE_COARSEN"  // see setRestrictionMethod()
  coarse_solver_type = "HYPRE_LEVEL_SOLVER"    // see setCoarseSolverType()
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ num_geometric_coarse_levels = 0              // see setNumGeometricCoarseLevels()
+ geometric_coarse_level_min_box_size = 8      // see setGeometricCoarseLevelMinBoxSize()
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
@@ -150,9 +154,25 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "L1_JACOBI"
+     * - \c "CHEBYSHEV"
+     *
+     * The Jacobi-type smoothers require only operator applications and update
+     * all degrees of freedom simultaneously.  The Chebyshev smoother uses the
+     * diagonal of the operator as a preconditioner and targets the interval
+     * [lower_eig_factor*lambda_max, upper_eig_factor*lambda_max], in which
+     * lambda_max is an upper bound on the largest eigenvalue of the
+     * diagonally scaled operator that is computed automatically on each level;
+     * the number of smoothing sweeps is the degree of the polynomial.
      */
     void setSmootherType(const std::string& smoother_type);
 
+    /*!
+     * \brief Specify the factors used to determine the eigenvalue interval
+     * targeted by the Chebyshev smoother.
+     */
+    void setChebyshevEigenvalueFactors(double lower_eig_factor, double upper_eig_factor);
+
     /*!
      * \brief Specify the coarse level solver.
      */
@@ -263,6 +283,13 @@ private:
     SAMRAI::tbox::Pointer<PoissonSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Parameters for Chebyshev smoothing, and the upper bounds on the largest
+     * eigenvalue of the diagonally scaled operator on each level.
+     */
+    double d_chebyshev_lower_eig_factor, d_chebyshev_upper_eig_factor;
+    std::vector<double> d_chebyshev_max_eig;
+
     /*
      * Patch overlap data.
      */
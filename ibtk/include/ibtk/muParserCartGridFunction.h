@@ -40,6 +40,7 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "PatchLevel.h"
 #include "boost/array.hpp"
@@ -72,6 +73,14 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * Functions are evaluated over entire patch boxes using the bulk evaluation
+ * mode of mu::Parser.  If the input database key
+ * <code>cache_time_independent_values</code> is set to <code>TRUE</code>, the
+ * values of functions that do not depend on time are cached and reused for
+ * subsequent evaluations on the same patch configuration.  Cached values are
+ * indexed by the patch level number, and the values cached for a level are
+ * discarded by resetHierarchyConfiguration().  Caching is disabled by default.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -112,6 +121,14 @@ public:
 
     //\}
 
+    /*!
+     * \brief Discard the cached values of time-independent functions on the
+     * levels of the patch hierarchy that have been reset.
+     */
+    void resetHierarchyConfiguration(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                     int coarsest_ln,
+                                     int finest_ln);
+
 private:
     /*!
      * \brief Default constructor.
@@ -164,10 +181,62 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * The centering of the patch data being filled.
+     */
+    enum DataCentering
+    {
+        CELL_CENTERING,
+        FACE_CENTERING,
+        NODE_CENTERING,
+        SIDE_CENTERING
+    };
+
+    /*!
+     * \brief Bind the parser variables to the bulk evaluation buffers, if
+     * necessary.
+     */
+    void bindParserVariables();
+
+    /*!
+     * \brief Evaluate the specified function at all of the locations of the
+     * specified centering on the patch, in the order of the corresponding SAMRAI
+     * patch data iterators.
+     */
+    const std::vector<double>& evaluateFunction(int function_depth,
+                                                DataCentering centering,
+                                                unsigned int axis,
+                                                const SAMRAI::hier::Patch<NDIM>& patch,
+                                                double data_time);
+
+    /*!
+     * Time and position variables, along with the function values, for bulk
+     * evaluation.
+     */
+    std::vector<double> d_bulk_time;
+    boost::array<std::vector<double>, NDIM> d_bulk_posn;
+    std::vector<double> d_bulk_values;
+    double* d_bound_time;
+    boost::array<double*, NDIM> d_bound_posn;
+
+    /*!
+     * Cached values of time-independent functions, indexed by the patch level
+     * number, the function, the data centering, and the patch configuration.
      */
-    double d_parser_time;
-    Point d_parser_posn;
+    struct ValueCacheKey
+    {
+        bool operator<(const ValueCacheKey& that) const;
+
+        int level_number;
+        int function_depth;
+        DataCentering centering;
+        unsigned int axis;
+        SAMRAI::hier::Box<NDIM> patch_box;
+        double x_lower[NDIM], dx[NDIM];
+    };
+
+    bool d_time_dependent, d_cache_time_independent_values;
+    std::map<ValueCacheKey, std::vector<double> > d_value_cache;
+    size_t d_value_cache_size;
 };
 } // namespace IBTK
 
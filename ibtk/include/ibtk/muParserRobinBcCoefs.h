@@ -157,6 +157,12 @@ public:
 
     //\}
 
+    /*!
+     * \brief Indicate whether none of the coefficient functions depend on the
+     * time variable.
+     */
+    bool getBcCoefsAreTimeIndependent() const;
+
 private:
     /*!
      * \brief Default constructor.
@@ -216,6 +222,11 @@ private:
      */
     double* d_parser_time;
     Point* d_parser_posn;
+
+    /*!
+     * Whether the coefficient functions are independent of time.
+     */
+    bool d_time_independent;
 };
 } // namespace IBTK
 
@@ -38,6 +38,11 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxGeometry.h"
+#include "BoxOverlap.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -48,9 +53,12 @@
 #include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "RefineAlgorithm.h"
 #include "RefineOperator.h"
 #include "RefinePatchStrategy.h"
@@ -71,9 +79,13 @@
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/AbstractStream.h"
+#include "tbox/Array.h"
 #include "tbox/Pointer.h"
+#include "tbox/Schedule.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
+#include "tbox/Transaction.h"
 #include "tbox/Utilities.h"
 
 namespace SAMRAI
@@ -103,9 +115,134 @@ static Timer* t_reset_transaction_components;
 static Timer* t_reinitialize_operator_state;
 static Timer* t_deallocate_operator_state;
 static Timer* t_fill_data;
+static Timer* t_fill_data_begin;
+static Timer* t_fill_data_end;
 static Timer* t_fill_data_coarsen;
 static Timer* t_fill_data_refine;
 static Timer* t_fill_data_set_physical_bcs;
+
+typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+
+// Transaction that copies the values of one transaction component from a
+// source patch into the ghost cells of a destination patch on the same level.
+//
+// The patch data indices are looked up in the transaction components each
+// time the transaction is processed, so that the cached transactions remain
+// valid when the components are reset.
+class HaloCopyTransaction : public Transaction
+{
+public:
+    HaloCopyTransaction(Pointer<PatchLevel<NDIM> > level,
+                        const std::vector<InterpolationTransactionComponent>& transaction_comps,
+                        const unsigned int comp_idx,
+                        const int dst_patch_num,
+                        const int src_patch_num,
+                        const IntVector<NDIM>& src_shift)
+        : d_level(level),
+          d_transaction_comps(transaction_comps),
+          d_comp_idx(comp_idx),
+          d_dst_patch_num(dst_patch_num),
+          d_src_patch_num(src_patch_num),
+          d_src_shift(src_shift)
+    {
+        // intentionally blank
+        return;
+    } // HaloCopyTransaction
+
+    ~HaloCopyTransaction()
+    {
+        // intentionally blank
+        return;
+    } // ~HaloCopyTransaction
+
+    bool canEstimateIncomingMessageSize()
+    {
+        return getDestinationPatchData()->canEstimateStreamSizeFromBox();
+    } // canEstimateIncomingMessageSize
+
+    int computeIncomingMessageSize()
+    {
+        return getDestinationPatchData()->getDataStreamSize(*computeOverlap());
+    } // computeIncomingMessageSize
+
+    int computeOutgoingMessageSize()
+    {
+        return getSourcePatchData()->getDataStreamSize(*computeOverlap());
+    } // computeOutgoingMessageSize
+
+    int getSourceProcessor()
+    {
+        return d_level->getMappingForPatch(d_src_patch_num);
+    } // getSourceProcessor
+
+    int getDestinationProcessor()
+    {
+        return d_level->getMappingForPatch(d_dst_patch_num);
+    } // getDestinationProcessor
+
+    void packStream(AbstractStream& stream)
+    {
+        getSourcePatchData()->packStream(stream, *computeOverlap());
+        return;
+    } // packStream
+
+    void unpackStream(AbstractStream& stream)
+    {
+        getDestinationPatchData()->unpackStream(stream, *computeOverlap());
+        return;
+    } // unpackStream
+
+    void copyLocalData()
+    {
+        getDestinationPatchData()->copy(*getSourcePatchData(), *computeOverlap());
+        return;
+    } // copyLocalData
+
+    void printClassData(std::ostream& stream) const
+    {
+        stream << "HaloCopyTransaction::printClassData() is not implemented\n";
+        return;
+    } // printClassData
+
+private:
+    HaloCopyTransaction(const HaloCopyTransaction& from);
+
+    HaloCopyTransaction& operator=(const HaloCopyTransaction& that);
+
+    Pointer<PatchData<NDIM> > getSourcePatchData() const
+    {
+        const int src_data_idx = d_transaction_comps[d_comp_idx].d_src_data_idx;
+        return d_level->getPatch(d_src_patch_num)->getPatchData(src_data_idx);
+    } // getSourcePatchData
+
+    Pointer<PatchData<NDIM> > getDestinationPatchData() const
+    {
+        const int dst_data_idx = d_transaction_comps[d_comp_idx].d_dst_data_idx;
+        return d_level->getPatch(d_dst_patch_num)->getPatchData(dst_data_idx);
+    } // getDestinationPatchData
+
+    Pointer<BoxOverlap<NDIM> > computeOverlap() const
+    {
+        const InterpolationTransactionComponent& transaction_comp = d_transaction_comps[d_comp_idx];
+        Pointer<PatchDataFactory<NDIM> > pdat_factory =
+            d_level->getPatchDescriptor()->getPatchDataFactory(transaction_comp.d_dst_data_idx);
+        const Box<NDIM>& dst_box = d_level->getBoxes()[d_dst_patch_num];
+        const Box<NDIM>& src_box = d_level->getBoxes()[d_src_patch_num];
+        Pointer<BoxGeometry<NDIM> > dst_box_geometry = pdat_factory->getBoxGeometry(dst_box);
+        Pointer<BoxGeometry<NDIM> > src_box_geometry = pdat_factory->getBoxGeometry(src_box);
+        const Box<NDIM> src_mask =
+            Box<NDIM>::grow(dst_box, pdat_factory->getGhostCellWidth()) * Box<NDIM>::shift(src_box, d_src_shift);
+        const bool overwrite_interior = false;
+        return transaction_comp.d_fill_pattern->calculateOverlap(
+            *dst_box_geometry, *src_box_geometry, dst_box, src_mask, overwrite_interior, d_src_shift);
+    } // computeOverlap
+
+    const Pointer<PatchLevel<NDIM> > d_level;
+    const std::vector<InterpolationTransactionComponent>& d_transaction_comps;
+    const unsigned int d_comp_idx;
+    const int d_dst_patch_num, d_src_patch_num;
+    const IntVector<NDIM> d_src_shift;
+};
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -113,6 +250,8 @@ static Timer* t_fill_data_set_physical_bcs;
 HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
     : d_is_initialized(false),
       d_homogeneous_bc(false),
+      d_fill_in_progress(false),
+      d_fill_time(0.0),
       d_transaction_comps(),
       d_hierarchy(NULL),
       d_grid_geom(NULL),
@@ -124,6 +263,9 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
       d_refine_alg(NULL),
       d_refine_strategy(NULL),
       d_refine_scheds(),
+      d_overlap_communication(false),
+      d_halo_sched(NULL),
+      d_halo_ghost_width(0),
       d_cf_bdry_ops(),
       d_extrap_bc_ops(),
       d_cc_robin_bc_ops(),
@@ -142,6 +284,9 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
         t_deallocate_operator_state =
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::deallocateOperatorState()");
         t_fill_data = TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::fillData()");
+        t_fill_data_begin =
+            TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::fillDataBegin()");
+        t_fill_data_end = TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::fillDataEnd()");
         t_fill_data_coarsen =
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::fillData()[coarsen]");
         t_fill_data_refine =
@@ -164,6 +309,17 @@ HierarchyGhostCellInterpolation::setHomogeneousBc(const bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+void
+HierarchyGhostCellInterpolation::setOverlapCommunication(const bool overlap_communication)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_fill_in_progress);
+#endif
+    d_overlap_communication = overlap_communication;
+    if (d_is_initialized) setupHaloSchedule();
+    return;
+} // setOverlapCommunication
+
 void
 HierarchyGhostCellInterpolation::initializeOperatorState(const InterpolationTransactionComponent transaction_comp,
                                                          const Pointer<PatchHierarchy<NDIM> > hierarchy,
@@ -350,6 +506,7 @@ HierarchyGhostCellInterpolation::initializeOperatorState(
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
         d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
     }
+    setupHaloSchedule();
 
     // Setup physical BC type.
     setHomogeneousBc(d_homogeneous_bc);
@@ -528,6 +685,7 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
     {
         d_refine_alg->resetSchedule(d_refine_scheds[dst_ln]);
     }
+    setupHaloSchedule();
 
     IBTK_TIMER_STOP(t_reset_transaction_components);
     return;
@@ -553,6 +711,10 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
 
     IBTK_TIMER_START(t_deallocate_operator_state);
 
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_fill_in_progress);
+#endif
+
     // Clear cached refinement operators.
     d_cf_bdry_ops.clear();
     d_extrap_bc_ops.clear();
@@ -570,6 +732,9 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
     d_refine_strategy = NULL;
     d_refine_scheds.clear();
 
+    d_halo_sched.setNull();
+    d_halo_ghost_width = 0;
+
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
 
@@ -582,9 +747,25 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
 {
     IBTK_TIMER_START(t_fill_data);
 
+    fillDataBegin(fill_time);
+    fillDataEnd();
+
+    IBTK_TIMER_STOP(t_fill_data);
+    return;
+} // fillData
+
+void
+HierarchyGhostCellInterpolation::fillDataBegin(double fill_time)
+{
+    IBTK_TIMER_START(t_fill_data_begin);
+
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(!d_fill_in_progress);
 #endif
+    d_fill_in_progress = true;
+    d_fill_time = fill_time;
+
     // Ensure the boundary condition objects are in the correct state.
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
@@ -592,6 +773,18 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
         if (d_sc_robin_bc_ops[comp_idx]) d_sc_robin_bc_ops[comp_idx]->setHomogeneousBc(d_homogeneous_bc);
     }
 
+    // Post the same-level ghost cell exchange and return so that the caller
+    // may work on patch interiors while messages are in flight.
+    if (d_halo_sched)
+    {
+        IBTK_TIMER_START(t_fill_data_refine);
+        d_halo_sched->beginCommunication();
+        IBTK_TIMER_STOP(t_fill_data_refine);
+
+        IBTK_TIMER_STOP(t_fill_data_begin);
+        return;
+    }
+
     // Synchronize data on the patch hierarchy prior to filling ghost cell
     // values.
     IBTK_TIMER_START(t_fill_data_coarsen);
@@ -625,6 +818,39 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     }
     IBTK_TIMER_STOP(t_fill_data_refine);
 
+    IBTK_TIMER_STOP(t_fill_data_begin);
+    return;
+} // fillDataBegin
+
+void
+HierarchyGhostCellInterpolation::fillDataEnd()
+{
+    IBTK_TIMER_START(t_fill_data_end);
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(d_fill_in_progress);
+#endif
+    const double fill_time = d_fill_time;
+
+    // Complete the same-level ghost cell exchange and use extrapolation to
+    // determine ghost cell values at physical boundaries.
+    if (d_halo_sched)
+    {
+        IBTK_TIMER_START(t_fill_data_refine);
+        d_halo_sched->finalizeCommunication();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+            {
+                d_refine_strategy->setPhysicalBoundaryConditions(*patch, fill_time, d_halo_ghost_width);
+            }
+        }
+        IBTK_TIMER_STOP(t_fill_data_refine);
+    }
+
     // Set Robin boundary conditions at physical boundaries.
     IBTK_TIMER_START(t_fill_data_set_physical_bcs);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -659,14 +885,127 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     }
     IBTK_TIMER_STOP(t_fill_data_set_physical_bcs);
 
-    IBTK_TIMER_STOP(t_fill_data);
+    d_fill_in_progress = false;
+
+    IBTK_TIMER_STOP(t_fill_data_end);
     return;
-} // fillData
+} // fillDataEnd
+
+bool
+HierarchyGhostCellInterpolation::fillDataOverlapsCommunication() const
+{
+    return !d_halo_sched.isNull();
+} // fillDataOverlapsCommunication
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+HierarchyGhostCellInterpolation::setupHaloSchedule()
+{
+    // The split exchange is only used when requested, and it only replaces the
+    // same-level refine schedule, which is all that is required to fill ghost
+    // cells on the coarsest level of the patch hierarchy when each component is
+    // filled in place.
+    bool use_halo_sched = d_overlap_communication && d_coarsest_ln == 0 && d_finest_ln == 0;
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size() && use_halo_sched; ++comp_idx)
+    {
+        use_halo_sched = d_transaction_comps[comp_idx].d_src_data_idx == d_transaction_comps[comp_idx].d_dst_data_idx;
+    }
+    if (!use_halo_sched)
+    {
+        d_halo_sched.setNull();
+        d_halo_ghost_width = 0;
+        return;
+    }
+
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+    IntVector<NDIM> ghost_width = 0;
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+    {
+        const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+        ghost_width.max(level->getPatchDescriptor()->getPatchDataFactory(dst_data_idx)->getGhostCellWidth());
+    }
+
+    // Reuse the cached transactions when they already connect every pair of
+    // patches required to fill the current ghost cell widths.
+    if (!d_halo_sched.isNull() && ghost_width <= d_halo_ghost_width) return;
+    d_halo_ghost_width = ghost_width;
+
+    // Determine the periodic shifts of the source patches.
+    const IntVector<NDIM> periodic_shift = d_grid_geom->getPeriodicShift(level->getRatio());
+    std::vector<IntVector<NDIM> > src_shifts;
+    int num_shifts = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_shifts *= 3;
+    for (int k = 0; k < num_shifts; ++k)
+    {
+        IntVector<NDIM> src_shift = 0;
+        bool valid_shift = true;
+        for (unsigned int d = 0, kk = k; d < NDIM; ++d, kk /= 3)
+        {
+            const int offset = static_cast<int>(kk % 3) - 1;
+            if (offset != 0 && periodic_shift(d) == 0) valid_shift = false;
+            src_shift(d) = offset * periodic_shift(d);
+        }
+        if (valid_shift) src_shifts.push_back(src_shift);
+    }
+
+    // Setup one transaction per component for each pair of patches whose
+    // ghost boxes overlap, including those pairs that merely share faces or
+    // nodes.  Each processor only keeps those transactions that involve one of
+    // its patches, and the neighbors of each local patch are found by querying
+    // the box tree of the level.  Transactions with a local destination patch
+    // are set up when searching for source patches, so that the search for
+    // destination patches only keeps remote ones.
+    d_halo_sched = new Schedule();
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+    const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const int local_patch_num = p();
+        const Box<NDIM>& local_box = boxes[local_patch_num];
+        for (unsigned int k = 0; k < src_shifts.size(); ++k)
+        {
+            const IntVector<NDIM>& src_shift = src_shifts[k];
+
+            // Source patches for the local patch: the shifted source box must
+            // intersect the grown local box.
+            Array<int> src_patch_nums;
+            box_tree->findOverlapIndices(
+                src_patch_nums, Box<NDIM>::shift(Box<NDIM>::grow(local_box, d_halo_ghost_width + 1), -src_shift));
+            for (int j = 0; j < src_patch_nums.size(); ++j)
+            {
+                const int src_patch_num = src_patch_nums[j];
+                if (src_patch_num == local_patch_num && src_shift == IntVector<NDIM>(0)) continue;
+                for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+                {
+                    d_halo_sched->appendTransaction(new HaloCopyTransaction(
+                        level, d_transaction_comps, comp_idx, local_patch_num, src_patch_num, src_shift));
+                }
+            }
+
+            // Remote destination patches for the local patch: the grown
+            // destination box must intersect the shifted local box.
+            Array<int> dst_patch_nums;
+            box_tree->findOverlapIndices(
+                dst_patch_nums, Box<NDIM>::grow(Box<NDIM>::shift(local_box, src_shift), d_halo_ghost_width + 1));
+            for (int j = 0; j < dst_patch_nums.size(); ++j)
+            {
+                const int dst_patch_num = dst_patch_nums[j];
+                if (processor_mapping.isMappingLocal(dst_patch_num)) continue;
+                for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+                {
+                    d_halo_sched->appendTransaction(new HaloCopyTransaction(
+                        level, d_transaction_comps, comp_idx, dst_patch_num, local_patch_num, src_shift));
+                }
+            }
+        }
+    }
+    return;
+} // setupHaloSchedule
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
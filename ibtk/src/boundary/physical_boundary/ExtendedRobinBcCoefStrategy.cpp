@@ -82,6 +82,18 @@ ExtendedRobinBcCoefStrategy::setHomogeneousBc(bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+bool
+ExtendedRobinBcCoefStrategy::getBcCoefsAreCacheable() const
+{
+    return false;
+} // getBcCoefsAreCacheable
+
+bool
+ExtendedRobinBcCoefStrategy::getBcCoefsAreTimeIndependent() const
+{
+    return false;
+} // getBcCoefsAreTimeIndependent
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
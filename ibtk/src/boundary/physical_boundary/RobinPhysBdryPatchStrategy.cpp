@@ -32,40 +32,55 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <ostream>
 #include <set>
 #include <vector>
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
+#include "CartesianPatchGeometry.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "RobinBcCoefStrategy.h"
+#include "Variable.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/muParserRobinBcCoefs.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Patch;
-} // namespace hier
-namespace solv
-{
-template <int DIM>
-class RobinBcCoefStrategy;
-} // namespace solv
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Maximum number of cached sets of boundary condition coefficients.  The cache
+// is cleared when this limit is reached, e.g., following repeated regridding.
+static const unsigned int MAX_BC_COEF_CACHE_SIZE = 4096;
+
+inline int
+compare_boxes(const Box<NDIM>& box0, const Box<NDIM>& box1)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (box0.lower(d) != box1.lower(d)) return box0.lower(d) < box1.lower(d) ? -1 : 1;
+        if (box0.upper(d) != box1.upper(d)) return box0.upper(d) < box1.upper(d) ? -1 : 1;
+    }
+    return 0;
+} // compare_boxes
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy() : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false)
+RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy()
+    : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false), d_bc_coef_cache()
 {
     // intentionally blank
     return;
@@ -127,6 +142,7 @@ RobinPhysBdryPatchStrategy::setPhysicalBcCoefs(const std::vector<RobinBcCoefStra
     }
 #endif
     d_bc_coefs = bc_coefs;
+    clearBcCoefCache();
     return;
 } // setPhysicalBcCoefs
 
@@ -143,6 +159,33 @@ RobinPhysBdryPatchStrategy::getHomogeneousBc() const
     return d_homogeneous_bc;
 } // getHomogeneousBc
 
+void
+RobinPhysBdryPatchStrategy::clearBcCoefCache()
+{
+    d_bc_coef_cache.clear();
+    return;
+} // clearBcCoefCache
+
+bool
+RobinPhysBdryPatchStrategy::getBcCoefsAreCacheable(const RobinBcCoefStrategy<NDIM>* const bc_coef)
+{
+    const ExtendedRobinBcCoefStrategy* const extended_bc_coef =
+        dynamic_cast<const ExtendedRobinBcCoefStrategy*>(bc_coef);
+    if (extended_bc_coef) return extended_bc_coef->getBcCoefsAreCacheable();
+    return dynamic_cast<const muParserRobinBcCoefs*>(bc_coef) != NULL;
+} // getBcCoefsAreCacheable
+
+bool
+RobinPhysBdryPatchStrategy::getBcCoefsAreTimeIndependent(const RobinBcCoefStrategy<NDIM>* const bc_coef)
+{
+    if (!getBcCoefsAreCacheable(bc_coef)) return false;
+    const ExtendedRobinBcCoefStrategy* const extended_bc_coef =
+        dynamic_cast<const ExtendedRobinBcCoefStrategy*>(bc_coef);
+    if (extended_bc_coef) return extended_bc_coef->getBcCoefsAreTimeIndependent();
+    const muParserRobinBcCoefs* const muparser_bc_coef = dynamic_cast<const muParserRobinBcCoefs*>(bc_coef);
+    return muparser_bc_coef && muparser_bc_coef->getBcCoefsAreTimeIndependent();
+} // getBcCoefsAreTimeIndependent
+
 void
 RobinPhysBdryPatchStrategy::preprocessRefine(Patch<NDIM>& /*fine*/,
                                              const Patch<NDIM>& /*coarse*/,
@@ -174,8 +217,99 @@ RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData(Patch<NDIM>& /*pa
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+RobinPhysBdryPatchStrategy::computeBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
+                                           Pointer<ArrayData<NDIM, double> >& bcoef_data,
+                                           Pointer<ArrayData<NDIM, double> >& gcoef_data,
+                                           RobinBcCoefStrategy<NDIM>* const bc_coef,
+                                           const int target_data_idx,
+                                           const Pointer<Variable<NDIM> >& var,
+                                           const Patch<NDIM>& patch,
+                                           const BoundaryBox<NDIM>& bdry_box,
+                                           const Box<NDIM>& bc_coef_box,
+                                           const double fill_time)
+{
+    ExtendedRobinBcCoefStrategy* const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+
+    // Determine whether the coefficients may be cached, and if so, whether
+    // previously computed values are available.
+    const bool cacheable = getBcCoefsAreCacheable(bc_coef);
+    const bool time_independent = cacheable && getBcCoefsAreTimeIndependent(bc_coef);
+    BcCoefCacheKey key;
+    if (cacheable)
+    {
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+        const double* const x_lower = pgeom->getXLower();
+        const double* const dx = pgeom->getDx();
+        key.bc_coef = bc_coef;
+        key.location_index = bdry_box.getLocationIndex();
+        key.bc_coef_box = bc_coef_box;
+        key.patch_box = patch.getBox();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            key.x_lower[d] = x_lower[d];
+            key.dx[d] = dx[d];
+        }
+        key.homogeneous_bc = d_homogeneous_bc;
+        std::map<BcCoefCacheKey, BcCoefCacheEntry>::const_iterator it = d_bc_coef_cache.find(key);
+        if (it != d_bc_coef_cache.end() && (time_independent || it->second.fill_time == fill_time))
+        {
+            acoef_data = it->second.acoef_data;
+            bcoef_data = it->second.bcoef_data;
+            gcoef_data = it->second.gcoef_data;
+            return;
+        }
+    }
+
+    // Compute the coefficients.
+    acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+    bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+    gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+    if (extended_bc_coef)
+    {
+        extended_bc_coef->setTargetPatchDataIndex(target_data_idx);
+        extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+    }
+    bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, var, patch, bdry_box, fill_time);
+    if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
+    if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+
+    // Store the coefficients for later reuse.
+    if (cacheable)
+    {
+        if (d_bc_coef_cache.size() >= MAX_BC_COEF_CACHE_SIZE && !d_bc_coef_cache.count(key))
+        {
+            d_bc_coef_cache.clear();
+        }
+        BcCoefCacheEntry& entry = d_bc_coef_cache[key];
+        entry.fill_time = fill_time;
+        entry.acoef_data = acoef_data;
+        entry.bcoef_data = bcoef_data;
+        entry.gcoef_data = gcoef_data;
+    }
+    return;
+} // computeBcCoefs
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+RobinPhysBdryPatchStrategy::BcCoefCacheKey::operator<(const BcCoefCacheKey& that) const
+{
+    if (bc_coef != that.bc_coef) return bc_coef < that.bc_coef;
+    if (location_index != that.location_index) return location_index < that.location_index;
+    if (homogeneous_bc != that.homogeneous_bc) return homogeneous_bc < that.homogeneous_bc;
+    const int bc_coef_box_cmp = compare_boxes(bc_coef_box, that.bc_coef_box);
+    if (bc_coef_box_cmp != 0) return bc_coef_box_cmp < 0;
+    const int patch_box_cmp = compare_boxes(patch_box, that.patch_box);
+    if (patch_box_cmp != 0) return patch_box_cmp < 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (x_lower[d] != that.x_lower[d]) return x_lower[d] < that.x_lower[d];
+        if (dx[d] != that.dx[d]) return dx[d] < that.dx[d];
+    }
+    return false;
+} // operator<
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
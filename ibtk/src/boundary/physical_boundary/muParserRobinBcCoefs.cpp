@@ -90,7 +90,8 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
       d_bcoef_parsers(2 * NDIM),
       d_gcoef_parsers(2 * NDIM),
       d_parser_time(new double),
-      d_parser_posn(new Point)
+      d_parser_posn(new Point),
+      d_time_independent(false)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -333,6 +334,21 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
             (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
         }
     }
+
+    // Determine whether any of the coefficient functions depend on time.
+    d_time_independent = true;
+    for (std::vector<mu::Parser*>::const_iterator cit = all_parsers.begin(); cit != all_parsers.end(); ++cit)
+    {
+        try
+        {
+            const mu::varmap_type& used_vars = (*cit)->GetUsedVar();
+            if (used_vars.count("t") || used_vars.count("T")) d_time_independent = false;
+        }
+        catch (...)
+        {
+            d_time_independent = false;
+        }
+    }
     return;
 } // muParserRobinBcCoefs
 
@@ -420,6 +436,12 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
     return EXTENSIONS_FILLABLE;
 } // numberOfExtensionsFillable
 
+bool
+muParserRobinBcCoefs::getBcCoefsAreTimeIndependent() const
+{
+    return d_time_independent;
+} // getBcCoefsAreTimeIndependent
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
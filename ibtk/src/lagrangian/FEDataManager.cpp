@@ -37,6 +37,7 @@
 #include <functional>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <stdbool.h>
@@ -48,6 +49,7 @@
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianCellDoubleWeightedAverage.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -182,6 +184,19 @@ struct ElemComp : std::binary_function<Elem*, Elem*, bool>
     } // operator()
 };
 
+PetscErrorCode
+apply_lumped_mass_preconditioner(PC pc, Vec x, Vec y)
+{
+    int ierr;
+    void* ctx;
+    ierr = PCShellGetContext(pc, &ctx);
+    CHKERRQ(ierr);
+    Vec M_diag_vec = static_cast<Vec>(ctx);
+    ierr = VecPointwiseDivide(y, x, M_diag_vec);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+} // apply_lumped_mass_preconditioner
+
 template <class ContainerOfContainers>
 inline void
 collect_unique_elems(std::vector<Elem*>& elems, const ContainerOfContainers& elem_patch_map)
@@ -253,6 +268,66 @@ get_elem_hmax(Elem* const elem, const boost::multi_array<double, 2>& X_node)
     }
     return hmax;
 } // get_elem_hmax
+
+inline void
+get_bin_range(int* const bin_range,
+              const Point& x_lower,
+              const Point& x_upper,
+              const double* const bin_x_lower,
+              const double* const bin_width,
+              const int* const n_bins)
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double n_max = static_cast<double>(n_bins[d] - 1);
+        const double lower = std::floor((x_lower[d] - bin_x_lower[d]) / bin_width[d]);
+        const double upper = std::floor((x_upper[d] - bin_x_lower[d]) / bin_width[d]);
+        bin_range[d] = static_cast<int>(std::min(std::max(lower, 0.0), n_max));
+        bin_range[NDIM + d] = static_cast<int>(std::min(std::max(upper, 0.0), n_max));
+    }
+    return;
+} // get_bin_range
+
+inline void
+get_bin_indices(std::vector<int>& bin_idxs, const int* const bin_range, const int* const n_bins)
+{
+    bin_idxs.clear();
+    int idx[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d) idx[d] = bin_range[d];
+    while (true)
+    {
+        int bin_idx = 0;
+        for (int d = NDIM - 1; d >= 0; --d) bin_idx = bin_idx * n_bins[d] + idx[d];
+        bin_idxs.push_back(bin_idx);
+        unsigned int d = 0;
+        while (d < NDIM && ++idx[d] > bin_range[NDIM + d])
+        {
+            idx[d] = bin_range[d];
+            ++d;
+        }
+        if (d == NDIM) break;
+    }
+    return;
+} // get_bin_indices
+
+inline void
+get_level_signature(std::vector<int>& signature, Pointer<PatchLevel<NDIM> > level)
+{
+    signature.clear();
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    const ProcessorMapping& mapping = level->getProcessorMapping();
+    for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+    {
+        const Box<NDIM>& box = boxes[k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            signature.push_back(box.lower()(d));
+            signature.push_back(box.upper()(d));
+        }
+        signature.push_back(mapping.getProcessorAssignment(k));
+    }
+    return;
+} // get_level_signature
 }
 
 const short int FEDataManager::ZERO_DISPLACEMENT_X_BDRY_ID = 0x100;
@@ -398,6 +473,14 @@ FEDataManager::reinitElementMappings()
 {
     IBTK_TIMER_START(t_reinit_element_mappings);
 
+    // Reuse the existing mappings when the patch level is unchanged and the
+    // structure has not moved appreciably.
+    if (elementMappingsAreValid())
+    {
+        IBTK_TIMER_STOP(t_reinit_element_mappings);
+        return;
+    }
+
     // Delete cached hierarchy-dependent data.
     d_active_patch_elem_map.clear();
     d_active_patch_ghost_dofs.clear();
@@ -409,13 +492,38 @@ FEDataManager::reinitElementMappings()
     }
     d_system_ghost_vec.clear();
 
-    // Reset the mappings between grid patches and active mesh elements.
-    collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
+    // Reset the mappings between grid patches and active mesh elements.  When
+    // the mappings may be reused after the structure has moved by up to the
+    // displacement threshold, the search region is grown by that amount so
+    // that elements that drift into the ghost region of a patch are not
+    // missed.  Spreading and interpolation only use those quadrature points
+    // that are actually within the ghost region.
+    IntVector<NDIM> mapping_ghost_width = d_ghost_width;
+    if (d_remap_displacement_threshold > 0.0)
+    {
+        mapping_ghost_width += static_cast<int>(std::ceil(d_remap_displacement_threshold));
+    }
+    collectActivePatchElements(d_active_patch_elem_map, d_level_number, mapping_ghost_width);
+
+    // Cache the data used to determine whether these mappings may be reused.
+    if (d_remap_displacement_threshold > 0.0)
+    {
+        delete d_X_mapping_vec;
+        d_X_mapping_vec = getCoordsVector()->clone().release(); // WARNING: must be manually deleted
+        get_level_signature(d_mapping_level_signature, d_hierarchy->getPatchLevel(d_level_number));
+    }
 
     IBTK_TIMER_STOP(t_reinit_element_mappings);
     return;
 } // reinitElementMappings
 
+void
+FEDataManager::setElementMappingDisplacementThreshold(const double threshold)
+{
+    d_remap_displacement_threshold = threshold;
+    return;
+} // setElementMappingDisplacementThreshold
+
 NumericVector<double>*
 FEDataManager::getSolutionVector(const std::string& system_name) const
 {
@@ -1410,6 +1518,43 @@ FEDataManager::restrictData(const int f_data_idx,
     return;
 } // restrictData
 
+void
+FEDataManager::setL2ProjectionSolverType(const std::string& solver_type)
+{
+    if (solver_type != "DEFAULT" && solver_type != "CHOLESKY" && solver_type != "LUMPED_MASS")
+    {
+        TBOX_ERROR(d_object_name << "::setL2ProjectionSolverType():\n"
+                                 << "  unsupported L2 projection solver type: "
+                                 << solver_type
+                                 << "\n"
+                                 << "  valid choices are: DEFAULT, CHOLESKY, LUMPED_MASS\n");
+    }
+    if (solver_type == d_L2_proj_solver_type) return;
+    d_L2_proj_solver_type = solver_type;
+    for (std::map<std::string, LinearSolver<double>*>::iterator it = d_L2_proj_solver.begin();
+         it != d_L2_proj_solver.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_solver.clear();
+    for (std::map<std::string, SparseMatrix<double>*>::iterator it = d_L2_proj_matrix.begin();
+         it != d_L2_proj_matrix.end();
+         ++it)
+    {
+        delete it->second;
+    }
+    d_L2_proj_matrix.clear();
+    return;
+} // setL2ProjectionSolverType
+
+int
+FEDataManager::getL2ProjectionIterations(const std::string& system_name) const
+{
+    std::map<std::string, int>::const_iterator cit = d_L2_proj_iterations.find(system_name);
+    return cit != d_L2_proj_iterations.end() ? cit->second : 0;
+} // getL2ProjectionIterations
+
 std::pair<LinearSolver<double>*, SparseMatrix<double>*>
 FEDataManager::buildL2ProjectionSolver(const std::string& system_name,
                                        const QuadratureType quad_type,
@@ -1531,6 +1676,68 @@ FEDataManager::buildL2ProjectionSolver(const std::string& system_name,
 
         // Setup the solver.
         solver->reuse_preconditioner(true);
+        if (d_L2_proj_solver_type != "DEFAULT")
+        {
+            int ierr;
+            KSP ksp = static_cast<PetscLinearSolver<double>*>(solver)->ksp();
+            Mat M_petsc_mat = static_cast<PetscMatrix<double>*>(M_mat)->mat();
+            PC pc;
+            ierr = KSPSetFromOptions(ksp);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetType(ksp, KSPCG);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPGetPC(ksp, &pc);
+            IBTK_CHKERRQ(ierr);
+            if (d_L2_proj_solver_type == "CHOLESKY")
+            {
+                // The mass matrix does not change, so its factorization is
+                // computed once and reused by all subsequent solves.
+                if (comm.size() == 1)
+                {
+                    ierr = PCSetType(pc, PCCHOLESKY);
+                    IBTK_CHKERRQ(ierr);
+                }
+                else
+                {
+                    ierr = PCSetType(pc, PCBJACOBI);
+                    IBTK_CHKERRQ(ierr);
+                    ierr = KSPSetOperators(ksp, M_petsc_mat, M_petsc_mat);
+                    IBTK_CHKERRQ(ierr);
+                    ierr = KSPSetUp(ksp);
+                    IBTK_CHKERRQ(ierr);
+                    PetscInt n_local_blocks;
+                    KSP* sub_ksps;
+                    ierr = PCBJacobiGetSubKSP(pc, &n_local_blocks, NULL, &sub_ksps);
+                    IBTK_CHKERRQ(ierr);
+                    for (PetscInt k = 0; k < n_local_blocks; ++k)
+                    {
+                        PC sub_pc;
+                        ierr = KSPSetType(sub_ksps[k], KSPPREONLY);
+                        IBTK_CHKERRQ(ierr);
+                        ierr = KSPGetPC(sub_ksps[k], &sub_pc);
+                        IBTK_CHKERRQ(ierr);
+                        ierr = PCSetType(sub_pc, PCCHOLESKY);
+                        IBTK_CHKERRQ(ierr);
+                    }
+                }
+            }
+            else if (d_L2_proj_solver_type == "LUMPED_MASS")
+            {
+                // The lumped mass matrix is spectrally equivalent to the
+                // consistent mass matrix, so it is an effective (and
+                // inexpensive) preconditioner.
+                PetscVector<double>* M_diag_vec =
+                    static_cast<PetscVector<double>*>(buildDiagonalL2MassMatrix(system_name));
+                ierr = PCSetType(pc, PCSHELL);
+                IBTK_CHKERRQ(ierr);
+                ierr = PCShellSetContext(pc, static_cast<void*>(M_diag_vec->vec()));
+                IBTK_CHKERRQ(ierr);
+                ierr = PCShellSetApply(pc, apply_lumped_mass_preconditioner);
+                IBTK_CHKERRQ(ierr);
+                ierr = PCShellSetName(pc, "lumped mass matrix");
+                IBTK_CHKERRQ(ierr);
+            }
+        }
 
         // Store the solver, mass matrix, and configuration options.
         d_L2_proj_solver[system_name] = solver;
@@ -1710,6 +1917,17 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
             buildL2ProjectionSolver(system_name, quad_type, quad_order);
         PetscLinearSolver<double>* solver = static_cast<PetscLinearSolver<double>*>(proj_solver_components.first);
         PetscMatrix<double>* M_mat = static_cast<PetscMatrix<double>*>(proj_solver_components.second);
+        if (d_L2_proj_solver_type == "LUMPED_MASS")
+        {
+            // Use the lumped-mass projection as the initial guess.
+            PetscVector<double>* M_diag_vec = static_cast<PetscVector<double>*>(buildDiagonalL2MassMatrix(system_name));
+            Vec U_petsc_vec = static_cast<PetscVector<double>*>(&U_vec)->vec();
+            Vec F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec)->vec();
+            ierr = VecPointwiseDivide(U_petsc_vec, F_petsc_vec, M_diag_vec->vec());
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetInitialGuessNonzero(solver->ksp(), PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
         PetscBool rtol_set;
         double runtime_rtol;
         ierr = PetscOptionsGetReal(NULL, "", "-ksp_rtol", &runtime_rtol, &rtol_set);
@@ -1718,14 +1936,21 @@ FEDataManager::computeL2Projection(NumericVector<double>& U_vec,
         int runtime_max_it;
         ierr = PetscOptionsGetInt(NULL, "", "-ksp_max_it", &runtime_max_it, &max_it_set);
         IBTK_CHKERRQ(ierr);
-        ierr = KSPSetFromOptions(solver->ksp());
-        IBTK_CHKERRQ(ierr);
+        if (d_L2_proj_solver_type == "DEFAULT")
+        {
+            ierr = KSPSetFromOptions(solver->ksp());
+            IBTK_CHKERRQ(ierr);
+        }
         solver->solve(
             *M_mat, *M_mat, U_vec, F_vec, rtol_set ? runtime_rtol : tol, max_it_set ? runtime_max_it : max_its);
         KSPConvergedReason reason;
         ierr = KSPGetConvergedReason(solver->ksp(), &reason);
         IBTK_CHKERRQ(ierr);
         converged = reason > 0;
+        int its;
+        ierr = KSPGetIterationNumber(solver->ksp(), &its);
+        IBTK_CHKERRQ(ierr);
+        d_L2_proj_iterations[system_name] = its;
     }
     else
     {
@@ -2059,11 +2284,19 @@ FEDataManager::FEDataManager(const std::string& object_name,
       d_es(NULL),
       d_level_number(-1),
       d_active_patch_ghost_dofs(),
+      d_elem_bin_offsets(),
+      d_elem_bin_elems(),
+      d_elem_bin_range(),
+      d_remap_displacement_threshold(0.0),
+      d_X_mapping_vec(NULL),
+      d_mapping_level_signature(),
       d_L2_proj_solver(),
       d_L2_proj_matrix(),
       d_L2_proj_matrix_diag(),
       d_L2_proj_quad_type(),
-      d_L2_proj_quad_order()
+      d_L2_proj_quad_order(),
+      d_L2_proj_solver_type("DEFAULT"),
+      d_L2_proj_iterations()
 {
     TBOX_ASSERT(!object_name.empty());
 
@@ -2139,6 +2372,7 @@ FEDataManager::~FEDataManager()
     {
         delete it->second;
     }
+    delete d_X_mapping_vec;
     return;
 } // ~FEDataManager
 
@@ -2312,6 +2546,164 @@ FEDataManager::computeActiveElementBoundingBoxes()
     return &d_active_elem_bboxes;
 } // computeActiveElementBoundingBoxes
 
+void
+FEDataManager::updateElementBins()
+{
+    const MeshBase& mesh = d_es->get_mesh();
+    const unsigned int n_elem = mesh.max_elem_id() + 1;
+
+    // Determine the extents of the mesh and of its largest element.
+    Point mesh_lower = Point::Constant(std::numeric_limits<double>::max());
+    Point mesh_upper = Point::Constant(-std::numeric_limits<double>::max());
+    double max_elem_extent = 0.0;
+    unsigned int n_active_elem = 0;
+    MeshBase::const_element_iterator el_it = mesh.active_elements_begin();
+    const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
+    for (; el_it != el_end; ++el_it, ++n_active_elem)
+    {
+        const unsigned int elem_id = (*el_it)->id();
+        const Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
+        const Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            mesh_lower[d] = std::min(mesh_lower[d], elem_lower_bound[d]);
+            mesh_upper[d] = std::max(mesh_upper[d], elem_upper_bound[d]);
+            max_elem_extent = std::max(max_elem_extent, elem_upper_bound[d] - elem_lower_bound[d]);
+        }
+    }
+    if (n_active_elem == 0)
+    {
+        d_elem_bin_offsets.clear();
+        d_elem_bin_elems.clear();
+        d_elem_bin_range.clear();
+        return;
+    }
+
+    // Rebuild the bin grid if the mesh has changed or if it has moved outside
+    // of the extents of the bin grid.
+    bool rebuild_bins = d_elem_bin_offsets.empty() || d_elem_bin_range.size() != 2 * NDIM * n_elem;
+    for (unsigned int d = 0; d < NDIM && !rebuild_bins; ++d)
+    {
+        rebuild_bins = mesh_lower[d] < d_elem_bin_x_lower[d] || mesh_upper[d] > d_elem_bin_x_upper[d];
+    }
+    if (rebuild_bins)
+    {
+        // The extents of the bin grid are padded so that moderate structural
+        // motion can be handled by incremental updates, and the bins are sized
+        // so that there is roughly one element per bin.
+        double volume = 1.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double pad = 0.25 * (mesh_upper[d] - mesh_lower[d]) + max_elem_extent;
+            d_elem_bin_x_lower[d] = mesh_lower[d] - pad;
+            d_elem_bin_x_upper[d] = mesh_upper[d] + pad;
+            volume *= d_elem_bin_x_upper[d] - d_elem_bin_x_lower[d];
+        }
+        const double bin_width = std::max(
+            std::pow(volume / static_cast<double>(n_active_elem), 1.0 / static_cast<double>(NDIM)), max_elem_extent);
+        int n_bins = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double extent = d_elem_bin_x_upper[d] - d_elem_bin_x_lower[d];
+            if (extent > 0.0 && bin_width > 0.0)
+            {
+                d_elem_bin_num[d] = std::max(1, static_cast<int>(std::ceil(extent / bin_width)));
+                d_elem_bin_width[d] = extent / static_cast<double>(d_elem_bin_num[d]);
+            }
+            else
+            {
+                d_elem_bin_num[d] = 1;
+                d_elem_bin_width[d] = 1.0;
+            }
+            n_bins *= d_elem_bin_num[d];
+        }
+        d_elem_bin_offsets.assign(n_bins + 1, 0);
+        d_elem_bin_range.assign(2 * NDIM * n_elem, -1);
+    }
+
+    // Determine the range of bins occupied by each element.  The binned
+    // element lists need to be regenerated only if some element now occupies a
+    // different range of bins.
+    bool bins_changed = rebuild_bins;
+    int bin_range[2 * NDIM];
+    for (el_it = mesh.active_elements_begin(); el_it != el_end; ++el_it)
+    {
+        const unsigned int elem_id = (*el_it)->id();
+        get_bin_range(bin_range,
+                      d_active_elem_bboxes[elem_id].first,
+                      d_active_elem_bboxes[elem_id].second,
+                      d_elem_bin_x_lower,
+                      d_elem_bin_width,
+                      d_elem_bin_num);
+        int* const old_bin_range = &d_elem_bin_range[2 * NDIM * elem_id];
+        if (std::equal(bin_range, bin_range + 2 * NDIM, old_bin_range)) continue;
+        std::copy(bin_range, bin_range + 2 * NDIM, old_bin_range);
+        bins_changed = true;
+    }
+    if (!bins_changed) return;
+
+    // Store the binned elements in compressed sparse row format: the elements
+    // in bin b are d_elem_bin_elems[k] for d_elem_bin_offsets[b] <= k <
+    // d_elem_bin_offsets[b+1].  This avoids allocating a separate list for each
+    // of the (mostly empty) bins, which are replicated on every process.
+    const int n_bins = static_cast<int>(d_elem_bin_offsets.size()) - 1;
+    std::fill(d_elem_bin_offsets.begin(), d_elem_bin_offsets.end(), 0);
+    std::vector<int> bin_idxs;
+    for (el_it = mesh.active_elements_begin(); el_it != el_end; ++el_it)
+    {
+        get_bin_indices(bin_idxs, &d_elem_bin_range[2 * NDIM * (*el_it)->id()], d_elem_bin_num);
+        for (std::vector<int>::const_iterator b = bin_idxs.begin(); b != bin_idxs.end(); ++b)
+        {
+            ++d_elem_bin_offsets[*b + 1];
+        }
+    }
+    std::partial_sum(d_elem_bin_offsets.begin(), d_elem_bin_offsets.end(), d_elem_bin_offsets.begin());
+    d_elem_bin_elems.resize(d_elem_bin_offsets[n_bins]);
+    std::vector<int> bin_fill_idx(d_elem_bin_offsets.begin(), d_elem_bin_offsets.end() - 1);
+    for (el_it = mesh.active_elements_begin(); el_it != el_end; ++el_it)
+    {
+        Elem* const elem = *el_it;
+        get_bin_indices(bin_idxs, &d_elem_bin_range[2 * NDIM * elem->id()], d_elem_bin_num);
+        for (std::vector<int>::const_iterator b = bin_idxs.begin(); b != bin_idxs.end(); ++b)
+        {
+            d_elem_bin_elems[bin_fill_idx[*b]++] = elem;
+        }
+    }
+    return;
+} // updateElementBins
+
+bool
+FEDataManager::elementMappingsAreValid()
+{
+    if (d_remap_displacement_threshold <= 0.0 || !d_X_mapping_vec) return false;
+    if (d_level_number > d_hierarchy->getFinestLevelNumber()) return false;
+
+    // The mappings cannot be reused if the patch level has changed.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_level_number);
+    std::vector<int> level_signature;
+    get_level_signature(level_signature, level);
+    if (level_signature != d_mapping_level_signature) return false;
+
+    // The mappings cannot be reused if the parallel layout of the coordinates
+    // vector has changed.
+    NumericVector<double>* X_vec = getCoordsVector();
+    const int layout_changed =
+        (X_vec->size() != d_X_mapping_vec->size() || X_vec->local_size() != d_X_mapping_vec->local_size()) ? 1 : 0;
+    if (SAMRAI_MPI::maxReduction(layout_changed) != 0) return false;
+
+    // Compare the maximum nodal displacement since the mappings were computed
+    // to the specified fraction of the grid spacing.
+    AutoPtr<NumericVector<double> > dX_vec = X_vec->clone();
+    dX_vec->add(-1.0, *d_X_mapping_vec);
+    const double max_displacement = std::sqrt(static_cast<double>(NDIM)) * dX_vec->linfty_norm();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const double* const dx0 = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = level->getRatio();
+    double dx_min = std::numeric_limits<double>::max();
+    for (unsigned int d = 0; d < NDIM; ++d) dx_min = std::min(dx_min, dx0[d] / static_cast<double>(ratio(d)));
+    return max_displacement <= d_remap_displacement_threshold * dx_min;
+} // elementMappingsAreValid
+
 void
 FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& active_patch_elems,
                                           const int level_number,
@@ -2348,8 +2740,13 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // NOTE: Following the call to computeActiveElementBoundingBoxes, each
     // processor will have access to all of the element bounding boxes.  This is
     // not a scalable approach, but we won't worry about this until it becomes
-    // an actual issue.
+    // an actual issue.  Candidate elements for each patch are found via the
+    // uniform bin grid, so that we do not need to test every element against
+    // every patch.
     computeActiveElementBoundingBoxes();
+    updateElementBins();
+    int bin_range[2 * NDIM];
+    std::vector<int> bin_idxs;
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
@@ -2366,24 +2763,29 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
             x_lower[d] -= dx[d] * ghost_width[d];
             x_upper[d] += dx[d] * ghost_width[d];
         }
+        if (d_elem_bin_offsets.empty()) continue;
 
-        MeshBase::const_element_iterator el_it = mesh.active_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
-        for (; el_it != el_end; ++el_it)
+        get_bin_range(bin_range, x_lower, x_upper, d_elem_bin_x_lower, d_elem_bin_width, d_elem_bin_num);
+        get_bin_indices(bin_idxs, bin_range, d_elem_bin_num);
+        for (std::vector<int>::const_iterator b = bin_idxs.begin(); b != bin_idxs.end(); ++b)
         {
-            Elem* const elem = *el_it;
-            const unsigned int elem_id = elem->id();
-            const Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
-            const Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
-            bool in_patch = true;
-            for (unsigned int d = 0; d < NDIM && in_patch; ++d)
-            {
-                in_patch = in_patch && ((elem_upper_bound[d] >= x_lower[d] && elem_upper_bound[d] <= x_upper[d]) ||
-                                        (elem_lower_bound[d] >= x_lower[d] && elem_lower_bound[d] <= x_upper[d]));
-            }
-            if (in_patch)
+            for (int k = d_elem_bin_offsets[*b]; k < d_elem_bin_offsets[*b + 1]; ++k)
             {
-                frontier_elems.insert(elem);
+                Elem* const elem = d_elem_bin_elems[k];
+                const unsigned int elem_id = elem->id();
+                const Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
+                const Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
+                bool in_patch = true;
+                for (unsigned int d = 0; d < NDIM && in_patch; ++d)
+                {
+                    in_patch =
+                        in_patch && ((elem_upper_bound[d] >= x_lower[d] && elem_upper_bound[d] <= x_upper[d]) ||
+                                     (elem_lower_bound[d] >= x_lower[d] && elem_lower_bound[d] <= x_upper[d]));
+                }
+                if (in_patch)
+                {
+                    frontier_elems.insert(elem);
+                }
             }
         }
     }
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -99,6 +100,7 @@
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
 // FORTRAN ROUTINES
@@ -3004,6 +3006,91 @@ HierarchyMathOps::pointwiseMaxNorm(const int dst_idx,
     return;
 } // pointwiseMaxNorm
 
+void
+HierarchyMathOps::divWithNorms(const int dst_idx,
+                               const Pointer<CellVariable<NDIM, double> > /*dst_var*/,
+                               const double alpha,
+                               const int src1_idx,
+                               const Pointer<SideVariable<NDIM, double> > /*src1_var*/,
+                               const Pointer<HierarchyGhostCellInterpolation> src1_ghost_fill,
+                               const double src1_ghost_fill_time,
+                               const bool src1_cf_bdry_synch,
+                               double& dst_l1_norm,
+                               double& dst_l2_norm,
+                               double& dst_max_norm,
+                               const double beta,
+                               const int src2_idx,
+                               const Pointer<CellVariable<NDIM, double> > /*src2_var*/,
+                               const int dst_depth,
+                               const int src2_depth)
+{
+    const int wgt_idx = getCellWeightPatchDescriptorIndex();
+
+    if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
+
+    double norms[2] = { 0.0, 0.0 };
+    double max_norm = 0.0;
+    for (int ln = d_finest_ln; ln >= d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+
+        // Allocate temporary data to synchronize the coarse-fine interface.
+        if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
+        {
+            level->allocatePatchData(d_os_idx);
+        }
+
+        // Compute the discrete divergence and its norms, and extract data on
+        // the coarse-fine interface.  The coarse-fine synchronization only
+        // modifies src1 on coarser levels, so the divergence is final once it
+        // has been computed on the present level.
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
+            Pointer<CellData<NDIM, double> > src2_data =
+                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+
+            d_patch_math_ops.divWithNorms(dst_data,
+                                          alpha,
+                                          src1_data,
+                                          beta,
+                                          src2_data,
+                                          wgt_data,
+                                          patch,
+                                          norms[0],
+                                          norms[1],
+                                          max_norm,
+                                          dst_depth,
+                                          src2_depth);
+
+            if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
+            {
+                Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+                os_data->copy(*src1_data);
+            }
+        }
+
+        // Synchronize the coarse-fine interface of src1 and deallocate
+        // temporary data.
+        if ((ln > d_coarsest_ln) && src1_cf_bdry_synch)
+        {
+            xeqScheduleOutersideRestriction(src1_idx, d_os_idx, ln - 1);
+            level->deallocatePatchData(d_os_idx);
+        }
+    }
+
+    // Combine the norms across processors.
+    SAMRAI_MPI::sumReduction(norms, 2);
+    dst_l1_norm = norms[0];
+    dst_l2_norm = std::sqrt(norms[1]);
+    dst_max_norm = SAMRAI_MPI::maxReduction(max_norm);
+    return;
+} // divWithNorms
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
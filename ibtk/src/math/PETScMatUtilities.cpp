@@ -118,7 +118,8 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
                                                   double data_time,
                                                   const std::vector<int>& num_dofs_per_proc,
                                                   const int dof_index_idx,
-                                                  Pointer<PatchLevel<NDIM> > patch_level)
+                                                  Pointer<PatchLevel<NDIM> > patch_level,
+                                                  const bool reuse_nonzero_structure)
 {
     constructPatchLevelCCLaplaceOp(mat,
                                    poisson_spec,
@@ -126,7 +127,8 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
                                    data_time,
                                    num_dofs_per_proc,
                                    dof_index_idx,
-                                   patch_level);
+                                   patch_level,
+                                   reuse_nonzero_structure);
     return;
 } // constructPatchLevelCCLaplaceOp
 
@@ -137,14 +139,10 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
                                                   double data_time,
                                                   const std::vector<int>& num_dofs_per_proc,
                                                   const int dof_index_idx,
-                                                  Pointer<PatchLevel<NDIM> > patch_level)
+                                                  Pointer<PatchLevel<NDIM> > patch_level,
+                                                  const bool reuse_nonzero_structure)
 {
     int ierr;
-    if (mat)
-    {
-        ierr = MatDestroy(&mat);
-        IBTK_CHKERRQ(ierr);
-    }
 
     const int depth = static_cast<int>(bc_coefs.size());
 
@@ -166,65 +164,70 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
     const int i_upper = i_lower + n_local;
     const int n_total = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
 
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    // Reuse the existing nonzero structure of the matrix if possible;
+    // otherwise, determine the nonzero structure and create the matrix.
+    if (!reusePatchLevelMatStructure(mat, num_dofs_per_proc, reuse_nonzero_structure))
     {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        // Determine the non-zero structure of the matrix.
+        std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
+        for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
 #if !defined(NDEBUG)
-        TBOX_ASSERT(depth == dof_index_data->getDepth());
+            TBOX_ASSERT(depth == dof_index_data->getDepth());
 #endif
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
-        {
-            const CellIndex<NDIM>& i = b();
-            for (int d = 0; d < depth; ++d)
+            for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
             {
-                const int dof_index = (*dof_index_data)(i, d);
-                if (i_lower <= dof_index && dof_index < i_upper)
+                const CellIndex<NDIM>& i = b();
+                for (int d = 0; d < depth; ++d)
                 {
-                    // Stencil for finite difference operator.
-                    const int local_idx = dof_index - i_lower;
-                    d_nnz[local_idx] += 1;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    const int dof_index = (*dof_index_data)(i, d);
+                    if (i_lower <= dof_index && dof_index < i_upper)
                     {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        // Stencil for finite difference operator.
+                        const int local_idx = dof_index - i_lower;
+                        d_nnz[local_idx] += 1;
+                        for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
                         {
-                            const int dof_index = (*dof_index_data)(i + stencil[stencil_index], d);
-                            if (dof_index >= i_lower && dof_index < i_upper)
+                            for (int side = 0; side <= 1; ++side, ++stencil_index)
                             {
-                                d_nnz[local_idx] += 1;
-                            }
-                            else
-                            {
-                                o_nnz[local_idx] += 1;
+                                const int dof_index = (*dof_index_data)(i + stencil[stencil_index], d);
+                                if (dof_index >= i_lower && dof_index < i_upper)
+                                {
+                                    d_nnz[local_idx] += 1;
+                                }
+                                else
+                                {
+                                    o_nnz[local_idx] += 1;
+                                }
                             }
                         }
+                        d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
+                        o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                     }
-                    d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
-                    o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                 }
             }
         }
-    }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        n_local,
-                        n_local,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        n_local ? &d_nnz[0] : NULL,
-                        0,
-                        n_local ? &o_nnz[0] : NULL,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+        // Create an empty matrix.
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            n_local,
+                            n_local,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            n_local ? &d_nnz[0] : NULL,
+                            0,
+                            n_local ? &o_nnz[0] : NULL,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
 
-    // Set block size.
-    ierr = MatSetBlockSize(mat, depth);
-    IBTK_CHKERRQ(ierr);
+        // Set block size.
+        ierr = MatSetBlockSize(mat, depth);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
@@ -285,18 +288,14 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
                                                   double data_time,
                                                   const std::vector<int>& num_dofs_per_proc,
                                                   const int dof_index_idx,
-                                                  Pointer<PatchLevel<NDIM> > patch_level)
+                                                  Pointer<PatchLevel<NDIM> > patch_level,
+                                                  const bool reuse_nonzero_structure)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(bc_coefs.size() == NDIM);
 #endif
 
     int ierr;
-    if (mat)
-    {
-        ierr = MatDestroy(&mat);
-        IBTK_CHKERRQ(ierr);
-    }
 
     // Setup the finite difference stencil.
     static const int stencil_sz = 2 * NDIM + 1;
@@ -316,61 +315,66 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
     const int i_upper = i_lower + n_local;
     const int n_total = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
 
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    // Reuse the existing nonzero structure of the matrix if possible;
+    // otherwise, determine the nonzero structure and create the matrix.
+    if (!reusePatchLevelMatStructure(mat, num_dofs_per_proc, reuse_nonzero_structure))
     {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        // Determine the non-zero structure of the matrix.
+        std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
+        for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
 #if !defined(NDEBUG)
-        TBOX_ASSERT(dof_index_data->getDepth() == 1);
+            TBOX_ASSERT(dof_index_data->getDepth() == 1);
 #endif
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                const int dof_index = (*dof_index_data)(i);
-                if (i_lower <= dof_index && dof_index < i_upper)
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
                 {
-                    // Stencil for finite difference operator.
-                    const int local_idx = dof_index - i_lower;
-                    d_nnz[local_idx] += 1;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                    const int dof_index = (*dof_index_data)(i);
+                    if (i_lower <= dof_index && dof_index < i_upper)
                     {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        // Stencil for finite difference operator.
+                        const int local_idx = dof_index - i_lower;
+                        d_nnz[local_idx] += 1;
+                        for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
                         {
-                            const int dof_index = (*dof_index_data)(i + stencil[stencil_index]);
-                            if (dof_index >= i_lower && dof_index < i_upper)
-                            {
-                                d_nnz[local_idx] += 1;
-                            }
-                            else
+                            for (int side = 0; side <= 1; ++side, ++stencil_index)
                             {
-                                o_nnz[local_idx] += 1;
+                                const int dof_index = (*dof_index_data)(i + stencil[stencil_index]);
+                                if (dof_index >= i_lower && dof_index < i_upper)
+                                {
+                                    d_nnz[local_idx] += 1;
+                                }
+                                else
+                                {
+                                    o_nnz[local_idx] += 1;
+                                }
                             }
                         }
+                        d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
+                        o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                     }
-                    d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
-                    o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                 }
             }
         }
-    }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        n_local,
-                        n_local,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        n_local ? &d_nnz[0] : NULL,
-                        0,
-                        n_local ? &o_nnz[0] : NULL,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+        // Create an empty matrix.
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            n_local,
+                            n_local,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            n_local ? &d_nnz[0] : NULL,
+                            0,
+                            n_local ? &o_nnz[0] : NULL,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
@@ -423,6 +427,45 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
     return;
 } // constructPatchLevelSCLaplaceOp
 
+bool
+PETScMatUtilities::reusePatchLevelMatStructure(Mat& mat,
+                                               const std::vector<int>& num_dofs_per_proc,
+                                               const bool reuse_nonzero_structure)
+{
+    int ierr;
+
+    // Check that the parallel layout of the existing matrix is unchanged on
+    // all processes.
+    int layout_changed = !reuse_nonzero_structure || !mat;
+    if (mat)
+    {
+        const int mpi_rank = SAMRAI_MPI::getRank();
+        PetscInt n_local, n_total;
+        ierr = MatGetLocalSize(mat, &n_local, NULL);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatGetSize(mat, &n_total, NULL);
+        IBTK_CHKERRQ(ierr);
+        layout_changed = layout_changed || n_local != num_dofs_per_proc[mpi_rank] ||
+                         n_total != std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
+    }
+    layout_changed = SAMRAI_MPI::maxReduction(layout_changed);
+    if (layout_changed)
+    {
+        if (mat)
+        {
+            ierr = MatDestroy(&mat);
+            IBTK_CHKERRQ(ierr);
+        }
+        return false;
+    }
+
+    // Because the same set of entries are inserted, any new nonzero location
+    // indicates that the DOF indexing has changed.
+    ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    return true;
+} // reusePatchLevelMatStructure
+
 void
 PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
                                                  void (*interp_fcn)(double r_lower, double* w),
@@ -108,6 +108,7 @@
 #define S_TO_C_CURL_FC IBTK_FC_FUNC(stoccurl2d, STOCCURL2D)
 #define S_TO_C_DIV_FC IBTK_FC_FUNC(stocdiv2d, STOCDIV2D)
 #define S_TO_C_DIV_ADD_FC IBTK_FC_FUNC(stocdivadd2d, STOCDIVADD2D)
+#define S_TO_C_DIV_NORMS_FC IBTK_FC_FUNC(stocdivnorms2d, STOCDIVNORMS2D)
 #define S_TO_C_INTERP_FC IBTK_FC_FUNC(stocinterp2nd2d, STOCINTERP2ND2D)
 
 #define S_TO_S_VC_LAPLACE_FC IBTK_FC_FUNC(stosvclaplace2d, STOSVCLAPLACE2D)
@@ -172,6 +173,7 @@
 #define S_TO_C_CURL_FC IBTK_FC_FUNC(stoccurl3d, STOCCURL3D)
 #define S_TO_C_DIV_FC IBTK_FC_FUNC(stocdiv3d, STOCDIV3D)
 #define S_TO_C_DIV_ADD_FC IBTK_FC_FUNC(stocdivadd3d, STOCDIVADD3D)
+#define S_TO_C_DIV_NORMS_FC IBTK_FC_FUNC(stocdivnorms3d, STOCDIVNORMS3D)
 #define S_TO_C_INTERP_FC IBTK_FC_FUNC(stocinterp2nd3d, STOCINTERP2ND3D)
 
 #define S_TO_S_CURL_FC IBTK_FC_FUNC(stoscurl3d, STOSCURL3D)
@@ -1026,6 +1028,33 @@ void S_TO_C_DIV_ADD_FC(double* D,
 #endif
                        const double* dx);
 
+void S_TO_C_DIV_NORMS_FC(double* D,
+                         const int& D_gcw,
+                         const double& alpha,
+                         const double* u0,
+                         const double* u1,
+#if (NDIM == 3)
+                         const double* u2,
+#endif
+                         const int& u_gcw,
+                         const double& beta,
+                         const double* V,
+                         const int& V_gcw,
+                         const double* wgt,
+                         const int& wgt_gcw,
+                         const int& ilower0,
+                         const int& iupper0,
+                         const int& ilower1,
+                         const int& iupper1,
+#if (NDIM == 3)
+                         const int& ilower2,
+                         const int& iupper2,
+#endif
+                         const double* dx,
+                         double& l1_norm,
+                         double& l2_norm_sq,
+                         double& max_norm);
+
 void S_TO_C_INTERP_FC(double* U,
                       const int& U_gcw,
                       const double* v0,
@@ -6930,6 +6959,109 @@ PatchMathOps::pointwiseMaxNorm(Pointer<NodeData<NDIM, double> > dst,
     return;
 } // pointwiseMaxNorm
 
+void
+PatchMathOps::divWithNorms(Pointer<CellData<NDIM, double> > dst,
+                           const double alpha,
+                           const Pointer<SideData<NDIM, double> > src1,
+                           const double beta,
+                           const Pointer<CellData<NDIM, double> > src2,
+                           const Pointer<CellData<NDIM, double> > wgt,
+                           const Pointer<Patch<NDIM> > patch,
+                           double& l1_norm,
+                           double& l2_norm_sq,
+                           double& max_norm,
+                           const int l,
+                           const int m) const
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    double* const D = dst->getPointer(l);
+    const int D_ghosts = (dst->getGhostCellWidth()).max();
+
+    const double* const u0 = src1->getPointer(0);
+    const double* const u1 = src1->getPointer(1);
+#if (NDIM == 3)
+    const double* const u2 = src1->getPointer(2);
+#endif
+    const int u_ghosts = (src1->getGhostCellWidth()).max();
+
+    const double* const W = wgt->getPointer();
+    const int W_ghosts = (wgt->getGhostCellWidth()).max();
+
+    const bool use_src2 = src2 && (beta != 0.0);
+    const double* const V = use_src2 ? src2->getPointer(m) : D;
+    const int V_ghosts = use_src2 ? (src2->getGhostCellWidth()).max() : D_ghosts;
+
+    const Box<NDIM>& patch_box = patch->getBox();
+
+#if !defined(NDEBUG)
+    if (D_ghosts != (dst->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::divWithNorms():\n"
+                   << "  dst does not have uniform ghost cell widths"
+                   << std::endl);
+    }
+
+    if (u_ghosts != (src1->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::divWithNorms():\n"
+                   << "  src1 does not have uniform ghost cell widths"
+                   << std::endl);
+    }
+
+    if (use_src2 && V_ghosts != (src2->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::divWithNorms():\n"
+                   << "  src2 does not have uniform ghost cell widths"
+                   << std::endl);
+    }
+
+    if (W_ghosts != (wgt->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::divWithNorms():\n"
+                   << "  wgt does not have uniform ghost cell widths"
+                   << std::endl);
+    }
+
+    if (patch_box != dst->getBox() || patch_box != src1->getBox() || patch_box != wgt->getBox() ||
+        (use_src2 && patch_box != src2->getBox()))
+    {
+        TBOX_ERROR("PatchMathOps::divWithNorms():\n"
+                   << "  dst, src1, src2, and wgt must all live on the same patch"
+                   << std::endl);
+    }
+#endif
+
+    S_TO_C_DIV_NORMS_FC(D,
+                        D_ghosts,
+                        alpha,
+                        u0,
+                        u1,
+#if (NDIM == 3)
+                        u2,
+#endif
+                        u_ghosts,
+                        use_src2 ? beta : 0.0,
+                        V,
+                        V_ghosts,
+                        W,
+                        W_ghosts,
+                        patch_box.lower(0),
+                        patch_box.upper(0),
+                        patch_box.lower(1),
+                        patch_box.upper(1),
+#if (NDIM == 3)
+                        patch_box.lower(2),
+                        patch_box.upper(2),
+#endif
+                        dx,
+                        l1_norm,
+                        l2_norm_sq,
+                        max_norm);
+    return;
+} // divWithNorms
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
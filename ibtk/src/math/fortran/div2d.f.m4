@@ -405,3 +405,85 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the cell centered divergence of a side centered normal
+c     vector field u=(u0,u1), D = alpha div u + beta V, and accumulate
+c     the weighted L1 norm, the square of the weighted L2 norm, and the
+c     max norm of D over the cells with positive weight, all in a
+c     single sweep over the patch.
+c
+c     When beta is zero, V is not referenced.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine stocdivnorms2d(
+     &     D,D_gcw,
+     &     alpha,
+     &     u0,u1,u_gcw,
+     &     beta,
+     &     V,V_gcw,
+     &     wgt,wgt_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     l1_norm,l2_norm_sq,max_norm)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER D_gcw,u_gcw,V_gcw,wgt_gcw
+
+      REAL alpha
+
+      REAL u0(SIDE2d0(ilower,iupper,u_gcw))
+      REAL u1(SIDE2d1(ilower,iupper,u_gcw))
+
+      REAL beta
+
+      REAL V(CELL2d(ilower,iupper,V_gcw))
+
+      REAL wgt(CELL2d(ilower,iupper,wgt_gcw))
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL D(CELL2d(ilower,iupper,D_gcw))
+
+      REAL l1_norm,l2_norm_sq,max_norm
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,dval,d_abs,w
+c
+c     Compute the cell centered divergence of u and accumulate its
+c     norms in the same loop, so that D is not re-read.
+c
+      fac0 = alpha/dx(0)
+      fac1 = alpha/dx(1)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            dval =
+     &           fac0*(u0(i0+1,i1)-u0(i0,i1)) +
+     &           fac1*(u1(i0,i1+1)-u1(i0,i1))
+            if (beta .ne. 0.d0) dval = dval + beta*V(i0,i1)
+            D(i0,i1) = dval
+            w = wgt(i0,i1)
+            if (w .gt. 0.d0) then
+               d_abs = dabs(dval)
+               l1_norm = l1_norm + w*d_abs
+               l2_norm_sq = l2_norm_sq + w*d_abs*d_abs
+               max_norm = dmax1(max_norm,d_abs)
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
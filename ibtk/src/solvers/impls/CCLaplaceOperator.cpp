@@ -37,11 +37,18 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "BoxList.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellDataFactory.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "SAMRAIVectorReal.h"
 #include "VariableFillPattern.h"
@@ -85,6 +92,48 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 static Timer* t_apply;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// Recompute F = alpha div grad U + beta U in the cells adjacent to the patch
+// boundary, using the same stencil as PatchMathOps::laplace().
+inline void
+compute_laplace_in_patch_boundary_cells(Pointer<CellData<NDIM, double> > F_data,
+                                        const int F_depth,
+                                        const double alpha,
+                                        const double beta,
+                                        Pointer<CellData<NDIM, double> > U_data,
+                                        const int U_depth,
+                                        Pointer<Patch<NDIM> > patch)
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    double fac[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+    }
+    CellData<NDIM, double>& F = *F_data;
+    const CellData<NDIM, double>& U = *U_data;
+    BoxList<NDIM> bdry_boxes(patch_box);
+    bdry_boxes.removeIntersections(Box<NDIM>::grow(patch_box, IntVector<NDIM>(-CELLG)));
+    for (BoxList<NDIM>::Iterator bl(bdry_boxes); bl; bl++)
+    {
+        for (Box<NDIM>::Iterator b(bl()); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            double F_i = beta == 0.0 ? 0.0 : beta * U(i, U_depth);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                CellIndex<NDIM> i_lower(i), i_upper(i);
+                i_lower(d) -= 1;
+                i_upper(d) += 1;
+                F_i += fac[d] * (U(i_lower, U_depth) + U(i_upper, U_depth) - 2.0 * U(i, U_depth));
+            }
+            F(i, F_depth) = F_i;
+        }
+    }
+    return;
+} // compute_laplace_in_patch_boundary_cells
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -174,8 +223,23 @@ CCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
     }
     d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
     d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
-    d_hier_bdry_fill->fillData(d_solution_time);
-    d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+
+    // When the ghost cell exchange can be overlapped with computation and the
+    // operator is evaluated patch-by-patch, compute the action of the operator
+    // while the exchange is in progress, and then recompute the values in the
+    // cells whose stencils reach ghost cells once the exchange has completed.
+    const bool overlap_communication = d_hier_bdry_fill->fillDataOverlapsCommunication() &&
+                                       !d_hier_math_ops_external && d_poisson_spec.dIsConstant() &&
+                                       (d_poisson_spec.cIsConstant() || d_poisson_spec.cIsZero());
+    if (overlap_communication)
+    {
+        d_hier_bdry_fill->fillDataBegin(d_solution_time);
+    }
+    else
+    {
+        d_hier_bdry_fill->fillData(d_solution_time);
+        d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+    }
 
     // Compute the action of the operator.
     for (int comp = 0; comp < d_ncomp; ++comp)
@@ -201,6 +265,29 @@ CCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
         }
     }
 
+    if (overlap_communication)
+    {
+        d_hier_bdry_fill->fillDataEnd();
+        d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+
+        const double alpha = d_poisson_spec.getDConstant();
+        const double beta = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int comp = 0; comp < d_ncomp; ++comp)
+            {
+                Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x.getComponentDescriptorIndex(comp));
+                Pointer<CellData<NDIM, double> > y_data = patch->getPatchData(y.getComponentDescriptorIndex(comp));
+                for (unsigned int l = 0; l < d_bc_coefs.size(); ++l)
+                {
+                    compute_laplace_in_patch_boundary_cells(y_data, l, alpha, beta, x_data, l, patch);
+                }
+            }
+        }
+    }
+
     IBTK_TIMER_STOP(t_apply);
     return;
 } // apply
@@ -266,7 +353,10 @@ CCLaplaceOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>&
     }
 
     // Initialize the interpolation operators.
+    // apply() overlaps the ghost cell exchange with computation only when it
+    // evaluates the operator patch-by-patch.
     d_hier_bdry_fill = new HierarchyGhostCellInterpolation();
+    d_hier_bdry_fill->setOverlapCommunication(!d_hier_math_ops_external);
     d_hier_bdry_fill->initializeOperatorState(d_transaction_comps, d_hierarchy, d_coarsest_ln, d_finest_ln);
 
     // Indicate the operator is initialized.
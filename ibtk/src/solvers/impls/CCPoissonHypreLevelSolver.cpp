@@ -41,6 +41,7 @@
 #include <vector>
 
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -57,6 +58,10 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "ProcessorMapping.h"
+#include "RefineAlgorithm.h"
+#include "RefinePatchStrategy.h"
+#include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
 #include "SideDataFactory.h"
@@ -132,6 +137,25 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
     : d_hierarchy(),
       d_level_num(-1),
       d_grid_aligned_anisotropy(true),
+      d_agglomeration_num_ranks(0),
+      d_agglomerate(false),
+      d_hypre_comm(MPI_COMM_NULL),
+      d_solver_level(),
+      d_agglomerated_x_idx(-1),
+      d_agglomerated_b_idx(-1),
+      d_gather_sched(),
+      d_scatter_sched(),
+      d_reuse_hypre_setup(false),
+      d_hypre_setup_cached(false),
+      d_cached_hierarchy(),
+      d_cached_level_num(-1),
+      d_cached_depth(0),
+      d_cached_ratio(0),
+      d_cached_boxes(),
+      d_cached_mapping(),
+      d_cached_C(0.0),
+      d_cached_D(0.0),
+      d_cached_bc_coefs(),
       d_depth(0),
       d_grid(NULL),
       d_stencil(NULL),
@@ -177,6 +201,9 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("agglomeration_num_ranks"))
+            d_agglomeration_num_ranks = input_db->getInteger("agglomeration_num_ranks");
+        if (input_db->keyExists("reuse_hypre_setup")) d_reuse_hypre_setup = input_db->getBool("reuse_hypre_setup");
 
         if (d_solver_type == "SMG" || d_precond_type == "SMG" || d_solver_type == "PFMG" || d_precond_type == "PFMG")
         {
@@ -219,6 +246,7 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_hypre_setup_cached) destroyHypreSetup();
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -239,7 +267,7 @@ CCPoissonHypreLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAI
     static const int comp = 0;
     const int x_idx = x.getComponentDescriptorIndex(comp);
     const int b_idx = b.getComponentDescriptorIndex(comp);
-    const bool converged = solveSystem(x_idx, b_idx);
+    const bool converged = d_agglomerate ? solveAgglomeratedSystem(x_idx, b_idx) : solveSystem(x_idx, b_idx);
 
     // Log solver info.
     if (d_enable_logging)
@@ -360,16 +388,53 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
 #endif
         d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
     }
-    allocateHypreData();
-    if (d_grid_aligned_anisotropy)
+    if (hypreSetupIsReusable())
     {
-        setMatrixCoefficients_aligned();
+        // Point the retained solver level at the current patch level.  The
+        // agglomeration schedules are rebuilt by the next solve.
+        if (d_agglomerate)
+        {
+            if (d_agglomerated_x_idx >= 0) d_solver_level->deallocatePatchData(d_agglomerated_x_idx);
+            if (d_agglomerated_b_idx >= 0) d_solver_level->deallocatePatchData(d_agglomerated_b_idx);
+            d_agglomerated_x_idx = -1;
+            d_agglomerated_b_idx = -1;
+            d_gather_sched.setNull();
+            d_scatter_sched.setNull();
+        }
+        else
+        {
+            d_solver_level = d_level;
+        }
+
+        // Only the diagonal shift may have changed; update the matrix in place
+        // and redo the hypre solver setup in that case.
+        const double C = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+        if (C != d_cached_C && d_hypre_comm != MPI_COMM_NULL)
+        {
+            updateMatrixDiagonal(C - d_cached_C);
+            destroyHypreSolver();
+            setupHypreSolver();
+        }
     }
     else
     {
-        setMatrixCoefficients_nonaligned();
+        if (d_hypre_setup_cached) destroyHypreSetup();
+        allocateSolverLevel();
+        if (d_hypre_comm != MPI_COMM_NULL)
+        {
+            allocateHypreData();
+            if (d_grid_aligned_anisotropy)
+            {
+                setMatrixCoefficients_aligned();
+            }
+            else
+            {
+                setMatrixCoefficients_nonaligned();
+            }
+            setupHypreSolver();
+        }
     }
-    setupHypreSolver();
+    if (d_reuse_hypre_setup) cacheHypreSetupConfiguration();
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -385,9 +450,15 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures unless they are to be reused.
+    if (d_reuse_hypre_setup)
+    {
+        d_hypre_setup_cached = true;
+    }
+    else
+    {
+        destroyHypreSetup();
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -400,21 +471,176 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+CCPoissonHypreLevelSolver::hypreSetupIsReusable() const
+{
+    if (!d_hypre_setup_cached) return false;
+
+    // Only constant-coefficient problems are reused, since variable
+    // coefficient data may change without any change to the patch data
+    // indices.
+    if (!((d_poisson_spec.cIsConstant() || d_poisson_spec.cIsZero()) && d_poisson_spec.dIsConstant())) return false;
+    if (d_poisson_spec.getDConstant() != d_cached_D) return false;
+
+    // Check the grid configuration and the boundary condition objects.
+    if (d_hierarchy.getPointer() != d_cached_hierarchy.getPointer() || d_level_num != d_cached_level_num ||
+        d_depth != d_cached_depth || !(d_level->getRatio() == d_cached_ratio) || d_bc_coefs != d_cached_bc_coefs)
+    {
+        return false;
+    }
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const ProcessorMapping& mapping = d_level->getProcessorMapping();
+    if (boxes.getNumberOfBoxes() != static_cast<int>(d_cached_boxes.size())) return false;
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        if (!(boxes[i] == d_cached_boxes[i]) || mapping.getProcessorAssignment(i) != d_cached_mapping[i]) return false;
+    }
+    return true;
+} // hypreSetupIsReusable
+
+void
+CCPoissonHypreLevelSolver::cacheHypreSetupConfiguration()
+{
+    d_cached_hierarchy = d_hierarchy;
+    d_cached_level_num = d_level_num;
+    d_cached_depth = d_depth;
+    d_cached_ratio = d_level->getRatio();
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const ProcessorMapping& mapping = d_level->getProcessorMapping();
+    d_cached_boxes.resize(boxes.getNumberOfBoxes());
+    d_cached_mapping.resize(boxes.getNumberOfBoxes());
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        d_cached_boxes[i] = boxes[i];
+        d_cached_mapping[i] = mapping.getProcessorAssignment(i);
+    }
+    d_cached_C = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+    d_cached_D = d_poisson_spec.dIsConstant() ? d_poisson_spec.getDConstant() : 0.0;
+    d_cached_bc_coefs = d_bc_coefs;
+    return;
+} // cacheHypreSetupConfiguration
+
+void
+CCPoissonHypreLevelSolver::updateMatrixDiagonal(const double diagonal_shift)
+{
+    // The constant C enters the discretization only through the diagonal
+    // stencil entry, including at physical boundaries.
+    int diagonal_stencil_index = static_cast<int>(
+        std::find(d_stencil_offsets.begin(), d_stencil_offsets.end(), Index<NDIM>(0)) - d_stencil_offsets.begin());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(diagonal_stencil_index < static_cast<int>(d_stencil_offsets.size()));
+#endif
+    for (PatchLevel<NDIM>::Iterator p(d_solver_level); p; p++)
+    {
+        const Box<NDIM>& patch_box = d_solver_level->getPatch(p())->getBox();
+        Index<NDIM> lower = patch_box.lower();
+        Index<NDIM> upper = patch_box.upper();
+        std::vector<double> shift_vals(patch_box.size(), diagonal_shift);
+        for (unsigned int k = 0; k < d_depth; ++k)
+        {
+            HYPRE_StructMatrixAddToBoxValues(d_matrices[k], lower, upper, 1, &diagonal_stencil_index, &shift_vals[0]);
+        }
+    }
+    for (unsigned int k = 0; k < d_depth; ++k)
+    {
+        HYPRE_StructMatrixAssemble(d_matrices[k]);
+    }
+    return;
+} // updateMatrixDiagonal
+
+void
+CCPoissonHypreLevelSolver::destroyHypreSetup()
+{
+    if (d_hypre_comm != MPI_COMM_NULL)
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
+    deallocateSolverLevel();
+    d_hypre_setup_cached = false;
+    return;
+} // destroyHypreSetup
+
+void
+CCPoissonHypreLevelSolver::allocateSolverLevel()
+{
+    const int num_ranks = SAMRAI_MPI::getNodes();
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const int num_boxes = boxes.getNumberOfBoxes();
+    d_agglomerate = d_agglomeration_num_ranks > 0 && d_agglomeration_num_ranks < num_ranks && d_level_num == 0;
+    const bool constant_coefficients =
+        (d_poisson_spec.cIsConstant() || d_poisson_spec.cIsZero()) && d_poisson_spec.dIsConstant();
+    if (d_agglomerate && !constant_coefficients)
+    {
+        IBTK_DO_ONCE(TBOX_WARNING(d_object_name << "::initializeSolverState():\n"
+                                                << "  coarse-level agglomeration requires constant coefficients;\n"
+                                                << "  solving on the original patch distribution instead."
+                                                << std::endl););
+        d_agglomerate = false;
+    }
+    if (!d_agglomerate)
+    {
+        d_solver_level = d_level;
+        d_hypre_comm = SAMRAI_MPI::getCommunicator();
+        return;
+    }
+
+    // Distribute the level boxes over the first agglomeration_num_ranks
+    // processes, assigning each box to the least loaded process.
+    const int num_agglomeration_ranks = std::min(d_agglomeration_num_ranks, num_boxes);
+    std::vector<int> rank_load(num_agglomeration_ranks, 0);
+    ProcessorMapping mapping(num_boxes);
+    for (int i = 0; i < num_boxes; ++i)
+    {
+        const int rank = static_cast<int>(std::min_element(rank_load.begin(), rank_load.end()) - rank_load.begin());
+        mapping.setProcessorAssignment(i, rank);
+        rank_load[rank] += boxes[i].size();
+    }
+    d_solver_level = new PatchLevel<NDIM>(
+        boxes, mapping, d_level->getRatio(), d_hierarchy->getGridGeometry(), d_level->getPatchDescriptor());
+    d_solver_level->setLevelNumber(d_level_num);
+
+    // Create the communicator used by hypre on the agglomerated level.
+    const int rank = SAMRAI_MPI::getRank();
+    const int color = rank < num_agglomeration_ranks ? 0 : MPI_UNDEFINED;
+    MPI_Comm_split(SAMRAI_MPI::getCommunicator(), color, rank, &d_hypre_comm);
+    return;
+} // allocateSolverLevel
+
+void
+CCPoissonHypreLevelSolver::deallocateSolverLevel()
+{
+    if (d_agglomerate)
+    {
+        if (d_agglomerated_x_idx >= 0) d_solver_level->deallocatePatchData(d_agglomerated_x_idx);
+        if (d_agglomerated_b_idx >= 0) d_solver_level->deallocatePatchData(d_agglomerated_b_idx);
+        if (d_hypre_comm != MPI_COMM_NULL) MPI_Comm_free(&d_hypre_comm);
+    }
+    d_agglomerate = false;
+    d_hypre_comm = MPI_COMM_NULL;
+    d_solver_level.setNull();
+    d_agglomerated_x_idx = -1;
+    d_agglomerated_b_idx = -1;
+    d_gather_sched.setNull();
+    d_scatter_sched.setNull();
+    return;
+} // deallocateSolverLevel
+
 void
 CCPoissonHypreLevelSolver::allocateHypreData()
 {
     // Get the MPI communicator.
-    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    MPI_Comm communicator = d_hypre_comm;
 
     // Setup the hypre grid.
     Pointer<CartesianGridGeometry<NDIM> > grid_geometry = d_hierarchy->getGridGeometry();
-    const IntVector<NDIM>& ratio = d_level->getRatio();
+    const IntVector<NDIM>& ratio = d_solver_level->getRatio();
     const IntVector<NDIM>& periodic_shift = grid_geometry->getPeriodicShift(ratio);
 
     HYPRE_StructGridCreate(communicator, NDIM, &d_grid);
-    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    for (PatchLevel<NDIM>::Iterator p(d_solver_level); p; p++)
     {
-        const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
+        const Box<NDIM>& patch_box = d_solver_level->getPatch(p())->getBox();
         Index<NDIM> lower = patch_box.lower();
         Index<NDIM> upper = patch_box.upper();
         HYPRE_StructGridSetExtents(d_grid, lower, upper);
@@ -534,9 +760,9 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
         stencil_indices[i] = i;
     }
     std::vector<double> mat_vals(stencil_sz, 0.0);
-    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    for (PatchLevel<NDIM>::Iterator p(d_solver_level); p; p++)
     {
-        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        Pointer<Patch<NDIM> > patch = d_solver_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz, IntVector<NDIM>(0));
         for (unsigned int k = 0; k < d_depth; ++k)
@@ -567,9 +793,9 @@ void
 CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 {
     static const IntVector<NDIM> no_ghosts = 0;
-    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    for (PatchLevel<NDIM>::Iterator p(d_solver_level); p; p++)
     {
-        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        Pointer<Patch<NDIM> > patch = d_solver_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
         const double* const dx = pgeom->getDx();
@@ -775,7 +1001,7 @@ void
 CCPoissonHypreLevelSolver::setupHypreSolver()
 {
     // Get the MPI communicator.
-    MPI_Comm communicator = SAMRAI_MPI::getCommunicator();
+    MPI_Comm communicator = d_hypre_comm;
 
     d_solvers.resize(d_depth);
     d_preconds.resize(d_depth);
@@ -1072,9 +1298,9 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     // solution and right-hand-side data to hypre structures.
     const IntVector<NDIM> ghosts = 1;
     const IntVector<NDIM> no_ghosts = 0;
-    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    for (PatchLevel<NDIM>::Iterator p(d_solver_level); p; p++)
     {
-        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        Pointer<Patch<NDIM> > patch = d_solver_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
 
@@ -1205,9 +1431,9 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     IBTK_TIMER_STOP(t_solve_system_hypre);
 
     // Pull the solution vector out of the hypre structures.
-    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    for (PatchLevel<NDIM>::Iterator p(d_solver_level); p; p++)
     {
-        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        Pointer<Patch<NDIM> > patch = d_solver_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
         copyFromHypre(*x_data, d_sol_vecs, patch_box);
@@ -1215,6 +1441,42 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     return (d_current_residual_norm <= d_rel_residual_tol || d_current_residual_norm <= d_abs_residual_tol);
 } // solveSystem
 
+bool
+CCPoissonHypreLevelSolver::solveAgglomeratedSystem(const int x_idx, const int b_idx)
+{
+    // (Re)build the schedules that move data between the original and the
+    // agglomerated patch distributions.
+    if (x_idx != d_agglomerated_x_idx || b_idx != d_agglomerated_b_idx)
+    {
+        if (d_agglomerated_x_idx >= 0) d_solver_level->deallocatePatchData(d_agglomerated_x_idx);
+        if (d_agglomerated_b_idx >= 0) d_solver_level->deallocatePatchData(d_agglomerated_b_idx);
+        d_solver_level->allocatePatchData(x_idx);
+        d_solver_level->allocatePatchData(b_idx);
+        d_agglomerated_x_idx = x_idx;
+        d_agglomerated_b_idx = b_idx;
+
+        RefinePatchStrategy<NDIM>* no_refine_patch_strategy = NULL;
+        Pointer<RefineAlgorithm<NDIM> > gather_alg = new RefineAlgorithm<NDIM>();
+        gather_alg->registerRefine(x_idx, x_idx, x_idx, NULL);
+        gather_alg->registerRefine(b_idx, b_idx, b_idx, NULL);
+        d_gather_sched = gather_alg->createSchedule(d_solver_level, d_level, no_refine_patch_strategy);
+        Pointer<RefineAlgorithm<NDIM> > scatter_alg = new RefineAlgorithm<NDIM>();
+        scatter_alg->registerRefine(x_idx, x_idx, x_idx, NULL);
+        d_scatter_sched = scatter_alg->createSchedule(d_level, d_solver_level, no_refine_patch_strategy);
+    }
+
+    // Gather the data, solve the system on the participating processes, and
+    // scatter the solution back.
+    d_gather_sched->fillData(d_solution_time);
+    if (d_hypre_comm != MPI_COMM_NULL) solveSystem(x_idx, b_idx);
+    d_scatter_sched->fillData(d_solution_time);
+
+    // Make the solver diagnostics available on all processes.
+    d_current_iterations = SAMRAI_MPI::bcast(d_current_iterations, 0);
+    MPI_Bcast(&d_current_residual_norm, 1, MPI_DOUBLE, 0, SAMRAI_MPI::getCommunicator());
+    return (d_current_residual_norm <= d_rel_residual_tol || d_current_residual_norm <= d_abs_residual_tol);
+} // solveAgglomeratedSystem
+
 void
 CCPoissonHypreLevelSolver::copyToHypre(const std::vector<HYPRE_StructVector>& vectors,
                                        const CellData<NDIM, double>& src_data,
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <math.h>
 #include <stddef.h>
 #include <algorithm>
 #include <functional>
@@ -66,6 +67,7 @@
 #include "SideData.h"
 #include "SideIndex.h"
 #include "Variable.h"
+#include "VariableContext.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "boost/array.hpp"
@@ -101,10 +103,18 @@
 #if (NDIM == 2)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
+#define JACOBI_SMOOTH_FC IBTK_FC_FUNC(jacobismooth2d, JACOBISMOOTH2D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp2d, GSSMOOTHSP2D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp2d, RBGSSMOOTHSP2D)
+#define JACOBI_SMOOTH_SP_FC IBTK_FC_FUNC(jacobismoothsp2d, JACOBISMOOTHSP2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
+#define JACOBI_SMOOTH_FC IBTK_FC_FUNC(jacobismooth3d, JACOBISMOOTH3D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp3d, GSSMOOTHSP3D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp3d, RBGSSMOOTHSP3D)
+#define JACOBI_SMOOTH_SP_FC IBTK_FC_FUNC(jacobismoothsp3d, JACOBISMOOTHSP3D)
 #endif
 
 // Function interfaces
@@ -141,6 +151,79 @@ void RB_GS_SMOOTH_FC(double* U,
 #endif
                      const double* dx,
                      const int& red_or_black);
+
+void JACOBI_SMOOTH_FC(double* U,
+                      const int& U_gcw,
+                      const double& alpha,
+                      const double& beta,
+                      const double* F,
+                      const int& F_gcw,
+                      double* D,
+                      const int& D_gcw,
+                      const double& omega,
+                      const double& gamma,
+                      const int& ilower0,
+                      const int& iupper0,
+                      const int& ilower1,
+                      const int& iupper1,
+#if (NDIM == 3)
+                      const int& ilower2,
+                      const int& iupper2,
+#endif
+                      const double* dx);
+
+void GS_SMOOTH_SP_FC(float* U,
+                     const int& U_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const float* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const double* dx);
+
+void RB_GS_SMOOTH_SP_FC(float* U,
+                        const int& U_gcw,
+                        const double& alpha,
+                        const double& beta,
+                        const float* F,
+                        const int& F_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const double* dx,
+                        const int& red_or_black);
+
+void JACOBI_SMOOTH_SP_FC(float* U,
+                         const int& U_gcw,
+                         const double& alpha,
+                         const double& beta,
+                         const float* F,
+                         const int& F_gcw,
+                         float* D,
+                         const int& D_gcw,
+                         const double& omega,
+                         const double& gamma,
+                         const int& ilower0,
+                         const int& iupper0,
+                         const int& ilower1,
+                         const int& iupper1,
+#if (NDIM == 3)
+                         const int& ilower2,
+                         const int& iupper2,
+#endif
+                         const double* dx);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -162,6 +245,12 @@ static const int DEFAULT_DATA_DEPTH = 1;
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
 
+// Width of the layer of interior cells along patch boundaries that is copied
+// from single-precision to double-precision error data before ghost cells are
+// refilled.  The quadratic coarse-fine interpolation and the physical boundary
+// extrapolation read up to two interior cells normal to the boundary.
+static const int SP_BDRY_STRIP_WIDTH = 2;
+
 // Types of refining and coarsening to perform prior to setting coarse-fine
 // boundary and physical boundary ghost cell values.
 static const std::string DATA_REFINE_TYPE = "NONE";
@@ -198,6 +287,8 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    L1_JACOBI,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -206,8 +297,10 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "L1_JACOBI") return L1_JACOBI;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -237,6 +330,71 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+inline bool
+use_jacobi_iteration(SmootherType smoother_type)
+{
+    if (smoother_type == L1_JACOBI || smoother_type == CHEBYSHEV)
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+} // use_jacobi_iteration
+
+// Compute the diagonal entry and the sum of the magnitudes of the off-diagonal
+// entries of the standard (2*NDIM+1)-point discretization of alpha div grad +
+// beta.
+inline void
+get_operator_diagonal(double& diag, double& off_diag_sum, const double alpha, const double beta, const double* const dx)
+{
+    double fac_sum = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac_sum += 1.0 / (dx[d] * dx[d]);
+    }
+    diag = beta - 2.0 * alpha * fac_sum;
+    off_diag_sum = 2.0 * fabs(alpha) * fac_sum;
+    return;
+} // get_operator_diagonal
+
+// Copy cell-centered values on the specified boxes, converting between
+// floating-point types as needed.
+template <class DstType, class SrcType>
+inline void
+copy_cell_data(CellData<NDIM, DstType>& dst_data, const CellData<NDIM, SrcType>& src_data, const BoxList<NDIM>& boxes)
+{
+    const int depth = dst_data.getDepth();
+    for (BoxList<NDIM>::Iterator bl(boxes); bl; bl++)
+    {
+        const Box<NDIM> box = bl() * dst_data.getGhostBox() * src_data.getGhostBox();
+        for (Box<NDIM>::Iterator b(box); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            for (int d = 0; d < depth; ++d)
+            {
+                dst_data(i, d) = static_cast<DstType>(src_data(i, d));
+            }
+        }
+    }
+    return;
+} // copy_cell_data
+
+// Register a scratch variable with the variable database, replacing the patch
+// data index of a variable of the same name registered by an earlier object.
+inline int
+register_scratch_variable(Pointer<Variable<NDIM> > var, Pointer<VariableContext> ctx, const IntVector<NDIM>& ghosts)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    if (var_db->checkVariableExists(var->getName()))
+    {
+        var = var_db->getVariable(var->getName());
+        var_db->removePatchDataIndex(var_db->mapVariableAndContextToIndex(var, ctx));
+    }
+    return var_db->registerVariableAndContext(var, ctx, ghosts);
+} // register_scratch_variable
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -252,7 +410,15 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
           default_options_prefix),
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
+      d_chebyshev_lower_eig_factor(0.1),
+      d_chebyshev_upper_eig_factor(1.1),
+      d_chebyshev_max_eig(),
+      d_use_single_precision_smoother(false),
+      d_error_sp_idx(-1),
+      d_residual_sp_idx(-1),
+      d_update_sp_idx(-1),
       d_patch_bc_box_overlap(),
+      d_patch_interior_bdry_boxes(),
       d_patch_neighbor_overlap()
 {
     // Set some default values.
@@ -272,6 +438,12 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     if (input_db)
     {
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("chebyshev_lower_eig_factor"))
+            d_chebyshev_lower_eig_factor = input_db->getDouble("chebyshev_lower_eig_factor");
+        if (input_db->keyExists("chebyshev_upper_eig_factor"))
+            d_chebyshev_upper_eig_factor = input_db->getDouble("chebyshev_upper_eig_factor");
+        if (input_db->keyExists("use_single_precision_smoother"))
+            d_use_single_precision_smoother = input_db->getBool("use_single_precision_smoother");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -309,6 +481,19 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     // Configure the coarse level solver.
     setCoarseSolverType(d_coarse_solver_type);
 
+    // Setup single-precision scratch variables.
+    const IntVector<NDIM> ghosts = d_gcw;
+    const IntVector<NDIM> no_ghosts = 0;
+    Pointer<CellVariable<NDIM, float> > error_sp_var =
+        new CellVariable<NDIM, float>(d_object_name + "::error_sp", DEFAULT_DATA_DEPTH);
+    Pointer<CellVariable<NDIM, float> > residual_sp_var =
+        new CellVariable<NDIM, float>(d_object_name + "::residual_sp", DEFAULT_DATA_DEPTH);
+    Pointer<CellVariable<NDIM, float> > update_sp_var =
+        new CellVariable<NDIM, float>(d_object_name + "::update_sp", DEFAULT_DATA_DEPTH);
+    d_error_sp_idx = register_scratch_variable(error_sp_var, d_context, ghosts);
+    d_residual_sp_idx = register_scratch_variable(residual_sp_var, d_context, no_ghosts);
+    d_update_sp_idx = register_scratch_variable(update_sp_var, d_context, no_ghosts);
+
     // Setup Timers.
     IBTK_DO_ONCE(t_smooth_error =
                      TimerManager::getManager()->getTimer("IBTK::CCPoissonPointRelaxationFACOperator::smoothError()");
@@ -335,6 +520,31 @@ CCPoissonPointRelaxationFACOperator::setSmootherType(const std::string& smoother
     return;
 } // setSmootherType
 
+void
+CCPoissonPointRelaxationFACOperator::setChebyshevEigenvalueFactors(const double lower_eig_factor,
+                                                                   const double upper_eig_factor)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0.0 < lower_eig_factor && lower_eig_factor < upper_eig_factor);
+#endif
+    d_chebyshev_lower_eig_factor = lower_eig_factor;
+    d_chebyshev_upper_eig_factor = upper_eig_factor;
+    return;
+} // setChebyshevEigenvalueFactors
+
+void
+CCPoissonPointRelaxationFACOperator::setUseSinglePrecisionSmoother(const bool use_single_precision_smoother)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setUseSinglePrecisionSmoother():\n"
+                                 << "  cannot be called while operator state is initialized"
+                                 << std::endl);
+    }
+    d_use_single_precision_smoother = use_single_precision_smoother;
+    return;
+} // setUseSinglePrecisionSmoother
+
 void
 CCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coarse_solver_type)
 {
@@ -380,6 +590,38 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
+    const bool jacobi_iteration = use_jacobi_iteration(smoother_type);
+    const bool single_precision = d_use_single_precision_smoother;
+
+    // Determine the parameters of the Chebyshev iteration.
+    //
+    // NOTE: The update direction used by the Jacobi-type smoothers is stored in
+    // the interior of the "scratch" data, which otherwise is used only to cache
+    // ghost cell values, or in the single-precision update data.
+    double chebyshev_theta = 0.0, chebyshev_delta = 0.0, chebyshev_rho = 0.0;
+    if (smoother_type == CHEBYSHEV)
+    {
+        const double max_eig = d_chebyshev_upper_eig_factor * d_chebyshev_max_eig[level_num];
+        const double min_eig = d_chebyshev_lower_eig_factor * d_chebyshev_max_eig[level_num];
+        chebyshev_theta = 0.5 * (max_eig + min_eig);
+        chebyshev_delta = 0.5 * (max_eig - min_eig);
+    }
+
+    // Copy the error and residual into the single-precision scratch data.
+    if (single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const BoxList<NDIM> patch_boxes(patch->getBox());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+            Pointer<CellData<NDIM, float> > residual_sp_data = patch->getPatchData(d_residual_sp_idx);
+            copy_cell_data(*error_sp_data, *error_data, patch_boxes);
+            copy_cell_data(*residual_sp_data, *residual_data, patch_boxes);
+        }
+    }
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
@@ -405,6 +647,40 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     if (red_black_ordering) num_sweeps *= 2;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
+        // Determine the coefficients of the Jacobi-type update.
+        double omega_fac = 1.0, gamma_fac = 0.0;
+        if (smoother_type == CHEBYSHEV)
+        {
+            const double sigma = chebyshev_theta / chebyshev_delta;
+            if (isweep == 0)
+            {
+                omega_fac = 1.0 / chebyshev_theta;
+                chebyshev_rho = 1.0 / sigma;
+            }
+            else
+            {
+                const double rho_new = 1.0 / (2.0 * sigma - chebyshev_rho);
+                omega_fac = 2.0 * rho_new / chebyshev_delta;
+                gamma_fac = rho_new * chebyshev_rho;
+                chebyshev_rho = rho_new;
+            }
+        }
+
+        // Copy the single-precision error adjacent to the patch boundaries
+        // into the double-precision error, from which the ghost cell values
+        // are computed.
+        if (single_precision && isweep > 0)
+        {
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+                copy_cell_data(*error_data, *error_sp_data, d_patch_interior_bdry_boxes[level_num][patch_counter]);
+            }
+        }
+
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
@@ -449,6 +725,19 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
+        // Copy the ghost cell values into the single-precision error.
+        if (single_precision)
+        {
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+                copy_cell_data(*error_sp_data, *error_data, d_patch_bc_box_overlap[level_num][patch_counter]);
+            }
+        }
+
         // Smooth the error on the patches.
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
@@ -466,6 +755,13 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, float> > error_sp_data, residual_sp_data, update_sp_data;
+            if (single_precision)
+            {
+                error_sp_data = patch->getPatchData(d_error_sp_idx);
+                residual_sp_data = patch->getPatchData(d_residual_sp_idx);
+                update_sp_data = patch->getPatchData(d_update_sp_idx);
+            }
 
             // Copy updated values from neighboring local patches.
             if (update_local_data)
@@ -478,8 +774,17 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const int src_patch_num = cit->first;
                     const Box<NDIM>& overlap = cit->second;
                     Pointer<Patch<NDIM> > src_patch = level->getPatch(src_patch_num);
-                    Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
-                    error_data->getArrayData().copy(src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    if (single_precision)
+                    {
+                        Pointer<CellData<NDIM, float> > src_error_sp_data = src_patch->getPatchData(d_error_sp_idx);
+                        error_sp_data->getArrayData().copy(
+                            src_error_sp_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    }
+                    else
+                    {
+                        Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
+                        error_data->getArrayData().copy(src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    }
                 }
             }
 
@@ -492,53 +797,180 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             // data.
             const double& alpha = d_poisson_spec.getDConstant();
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
-            for (int depth = 0; depth < error_data->getDepth(); ++depth)
+            Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+            double omega = 0.0;
+            if (jacobi_iteration)
             {
-                double* const U = error_data->getPointer(depth);
-                const int U_ghosts = (error_data->getGhostCellWidth()).max();
-                const double* const F = residual_data->getPointer(depth);
-                const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-                if (red_black_ordering)
+                double diag, off_diag_sum;
+                get_operator_diagonal(diag, off_diag_sum, alpha, beta, dx);
+                omega = omega_fac / diag;
+                if (smoother_type == L1_JACOBI) omega = 1.0 / (diag + (diag < 0.0 ? -off_diag_sum : off_diag_sum));
+                if (isweep == 0)
                 {
-                    int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                    RB_GS_SMOOTH_FC(U,
-                                    U_ghosts,
-                                    alpha,
-                                    beta,
-                                    F,
-                                    F_ghosts,
-                                    patch_box.lower(0),
-                                    patch_box.upper(0),
-                                    patch_box.lower(1),
-                                    patch_box.upper(1),
+                    if (single_precision)
+                        update_sp_data->fillAll(0.0f, patch_box);
+                    else
+                        scratch_data->fillAll(0.0, patch_box);
+                }
+            }
+            if (single_precision)
+            {
+                for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                {
+                    float* const U = error_sp_data->getPointer(depth);
+                    const int U_ghosts = (error_sp_data->getGhostCellWidth()).max();
+                    const float* const F = residual_sp_data->getPointer(depth);
+                    const int F_ghosts = (residual_sp_data->getGhostCellWidth()).max();
+                    if (jacobi_iteration)
+                    {
+                        float* const D = update_sp_data->getPointer(depth);
+                        const int D_ghosts = (update_sp_data->getGhostCellWidth()).max();
+                        JACOBI_SMOOTH_SP_FC(U,
+                                            U_ghosts,
+                                            alpha,
+                                            beta,
+                                            F,
+                                            F_ghosts,
+                                            D,
+                                            D_ghosts,
+                                            omega,
+                                            gamma_fac,
+                                            patch_box.lower(0),
+                                            patch_box.upper(0),
+                                            patch_box.lower(1),
+                                            patch_box.upper(1),
+#if (NDIM == 3)
+                                            patch_box.lower(2),
+                                            patch_box.upper(2),
+#endif
+                                            dx);
+                    }
+                    else if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        RB_GS_SMOOTH_SP_FC(U,
+                                           U_ghosts,
+                                           alpha,
+                                           beta,
+                                           F,
+                                           F_ghosts,
+                                           patch_box.lower(0),
+                                           patch_box.upper(0),
+                                           patch_box.lower(1),
+                                           patch_box.upper(1),
 #if (NDIM == 3)
-                                    patch_box.lower(2),
-                                    patch_box.upper(2),
+                                           patch_box.lower(2),
+                                           patch_box.upper(2),
 #endif
-                                    dx,
-                                    red_or_black);
+                                           dx,
+                                           red_or_black);
+                    }
+                    else
+                    {
+                        GS_SMOOTH_SP_FC(U,
+                                        U_ghosts,
+                                        alpha,
+                                        beta,
+                                        F,
+                                        F_ghosts,
+                                        patch_box.lower(0),
+                                        patch_box.upper(0),
+                                        patch_box.lower(1),
+                                        patch_box.upper(1),
+#if (NDIM == 3)
+                                        patch_box.lower(2),
+                                        patch_box.upper(2),
+#endif
+                                        dx);
+                    }
                 }
-                else
+            }
+            else
+            {
+                for (int depth = 0; depth < error_data->getDepth(); ++depth)
                 {
-                    GS_SMOOTH_FC(U,
-                                 U_ghosts,
-                                 alpha,
-                                 beta,
-                                 F,
-                                 F_ghosts,
-                                 patch_box.lower(0),
-                                 patch_box.upper(0),
-                                 patch_box.lower(1),
-                                 patch_box.upper(1),
+                    double* const U = error_data->getPointer(depth);
+                    const int U_ghosts = (error_data->getGhostCellWidth()).max();
+                    const double* const F = residual_data->getPointer(depth);
+                    const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                    if (jacobi_iteration)
+                    {
+                        double* const D = scratch_data->getPointer(depth);
+                        const int D_ghosts = (scratch_data->getGhostCellWidth()).max();
+                        JACOBI_SMOOTH_FC(U,
+                                         U_ghosts,
+                                         alpha,
+                                         beta,
+                                         F,
+                                         F_ghosts,
+                                         D,
+                                         D_ghosts,
+                                         omega,
+                                         gamma_fac,
+                                         patch_box.lower(0),
+                                         patch_box.upper(0),
+                                         patch_box.lower(1),
+                                         patch_box.upper(1),
 #if (NDIM == 3)
-                                 patch_box.lower(2),
-                                 patch_box.upper(2),
+                                         patch_box.lower(2),
+                                         patch_box.upper(2),
 #endif
-                                 dx);
+                                         dx);
+                    }
+                    else if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        RB_GS_SMOOTH_FC(U,
+                                        U_ghosts,
+                                        alpha,
+                                        beta,
+                                        F,
+                                        F_ghosts,
+                                        patch_box.lower(0),
+                                        patch_box.upper(0),
+                                        patch_box.lower(1),
+                                        patch_box.upper(1),
+#if (NDIM == 3)
+                                        patch_box.lower(2),
+                                        patch_box.upper(2),
+#endif
+                                        dx,
+                                        red_or_black);
+                    }
+                    else
+                    {
+                        GS_SMOOTH_FC(U,
+                                     U_ghosts,
+                                     alpha,
+                                     beta,
+                                     F,
+                                     F_ghosts,
+                                     patch_box.lower(0),
+                                     patch_box.upper(0),
+                                     patch_box.lower(1),
+                                     patch_box.upper(1),
+#if (NDIM == 3)
+                                     patch_box.lower(2),
+                                     patch_box.upper(2),
+#endif
+                                     dx);
+                    }
                 }
             }
         }
     }
+
+    // Copy the smoothed error back into the double-precision error.
+    if (single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+            copy_cell_data(*error_data, *error_sp_data, BoxList<NDIM>(patch->getBox()));
+        }
+    }
     IBTK_TIMER_STOP(t_smooth_error);
     return;
 } // smoothError
@@ -559,10 +991,20 @@ CCPoissonPointRelaxationFACOperator::solveCoarsestLevel(SAMRAIVectorReal<NDIM, d
         d_coarse_solver->setMaxIterations(d_coarse_solver_max_iterations);
         d_coarse_solver->setAbsoluteTolerance(d_coarse_solver_abs_residual_tol);
         d_coarse_solver->setRelativeTolerance(d_coarse_solver_rel_residual_tol);
-        LinearSolver* p_coarse_solver = dynamic_cast<LinearSolver*>(d_coarse_solver.getPointer());
-        if (p_coarse_solver) p_coarse_solver->setInitialGuessNonzero(true);
-        d_coarse_solver->solveSystem(*getLevelSAMRAIVectorReal(error, d_coarsest_ln),
-                                     *getLevelSAMRAIVectorReal(residual, d_coarsest_ln));
+        if (d_geometric_coarse_hierarchy)
+        {
+            // Solve on level 0 and the geometric coarse levels below it.
+            copyToGeometricCoarseLevels(error, residual, coarsest_ln);
+            d_coarse_solver->solveSystem(*d_geometric_coarse_solution, *d_geometric_coarse_rhs);
+            copyFromGeometricCoarseLevels(error, coarsest_ln);
+        }
+        else
+        {
+            LinearSolver* p_coarse_solver = dynamic_cast<LinearSolver*>(d_coarse_solver.getPointer());
+            if (p_coarse_solver) p_coarse_solver->setInitialGuessNonzero(true);
+            d_coarse_solver->solveSystem(*getLevelSAMRAIVectorReal(error, d_coarsest_ln),
+                                         *getLevelSAMRAIVectorReal(residual, d_coarsest_ln));
+        }
     }
     else
     {
@@ -690,6 +1132,45 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
 
+    // Allocate the single-precision scratch data.
+    if (d_use_single_precision_smoother)
+    {
+        const int sp_idxs[3] = { d_error_sp_idx, d_residual_sp_idx, d_update_sp_idx };
+        for (int k = 0; k < 3; ++k)
+        {
+            Pointer<CellDataFactory<NDIM, float> > sp_pdat_fac =
+                var_db->getPatchDescriptor()->getPatchDataFactory(sp_idxs[k]);
+            sp_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+            for (int ln = std::max(d_coarsest_ln, coarsest_reset_ln); ln <= finest_reset_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+                if (!level->checkAllocated(sp_idxs[k])) level->allocatePatchData(sp_idxs[k]);
+            }
+        }
+    }
+
+    // Bound the largest eigenvalue of the diagonally scaled operator on each
+    // level (as required by the Chebyshev smoother) via Gershgorin's theorem.
+    // For the constant-coefficient operators treated by this class, this bound
+    // is sharp as the grid is refined.
+    d_chebyshev_max_eig.resize(d_finest_ln + 1, 0.0);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const double alpha = d_poisson_spec.getDConstant();
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        double dx[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        }
+        double diag, off_diag_sum;
+        get_operator_diagonal(diag, off_diag_sum, alpha, beta, dx);
+        d_chebyshev_max_eig[ln] = 1.0 + off_diag_sum / fabs(diag);
+    }
+
     // Initialize the coarse level solvers when needed.
     if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver)
     {
@@ -700,8 +1181,26 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         d_coarse_solver->setPoissonSpecifications(d_poisson_spec);
         d_coarse_solver->setPhysicalBcCoefs(d_bc_coefs);
         d_coarse_solver->setHomogeneousBc(true);
-        d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
-                                               *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        if (d_coarsest_ln == 0 && d_num_geometric_coarse_levels > 0)
+        {
+            const bool coefs_are_constant =
+                (d_poisson_spec.cIsConstant() || d_poisson_spec.cIsZero()) && d_poisson_spec.dIsConstant();
+            initializeGeometricCoarseLevels(*d_solution,
+                                            *d_rhs,
+                                            d_coarsest_ln,
+                                            d_num_geometric_coarse_levels,
+                                            d_coarse_solver.getPointer(),
+                                            coefs_are_constant);
+        }
+        if (d_geometric_coarse_hierarchy)
+        {
+            d_coarse_solver->initializeSolverState(*d_geometric_coarse_solution, *d_geometric_coarse_rhs);
+        }
+        else
+        {
+            d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
+                                                   *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        }
     }
 
     // Setup specialized transfer operators.
@@ -736,6 +1235,28 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         }
     }
 
+    // Get the interior cells adjacent to the patch boundaries that are copied
+    // out of the single-precision error before ghost cells are refilled.
+    if (d_use_single_precision_smoother)
+    {
+        d_patch_interior_bdry_boxes.resize(d_finest_ln + 1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_interior_bdry_boxes[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                d_patch_interior_bdry_boxes[ln][patch_counter] = BoxList<NDIM>(patch_box);
+                d_patch_interior_bdry_boxes[ln][patch_counter].removeIntersections(
+                    Box<NDIM>::grow(patch_box, IntVector<NDIM>(-SP_BDRY_STRIP_WIDTH)));
+            }
+        }
+    }
+
     // Get overlap information for re-setting patch boundary conditions during
     // smoothing.
     d_patch_neighbor_overlap.resize(d_finest_ln + 1);
@@ -768,16 +1289,30 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    // Deallocate the single-precision scratch data.
+    const int sp_idxs[3] = { d_error_sp_idx, d_residual_sp_idx, d_update_sp_idx };
+    for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (int k = 0; k < 3; ++k)
+        {
+            if (level->checkAllocated(sp_idxs[k])) level->deallocatePatchData(sp_idxs[k]);
+        }
+    }
+
     if (!d_in_initialize_operator_state)
     {
+        d_chebyshev_max_eig.clear();
         d_patch_bc_box_overlap.clear();
+        d_patch_interior_bdry_boxes.clear();
         d_patch_neighbor_overlap.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
+        deallocateGeometricCoarseLevels();
     }
     return;
 } // deallocateOperatorStateSpecialized
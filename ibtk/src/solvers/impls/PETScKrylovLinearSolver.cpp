@@ -33,6 +33,8 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <algorithm>
+#include <deque>
+#include <limits>
 #include <math.h>
 #include <ostream>
 #include <stddef.h>
@@ -82,6 +84,21 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Pipelined Krylov methods that overlap global reductions with operator and
+// preconditioner applications via PETSc's split-phase reduction interface.
+static const char* const PIPELINED_KSP_TYPES[] = { "pipecg", "pipecr", "pgmres", "pipegcr", "pipefcg", "groppcg" };
+static const int NUM_PIPELINED_KSP_TYPES = sizeof(PIPELINED_KSP_TYPES) / sizeof(PIPELINED_KSP_TYPES[0]);
+
+inline bool
+is_pipelined_ksp_type(const std::string& ksp_type)
+{
+    for (int k = 0; k < NUM_PIPELINED_KSP_TYPES; ++k)
+    {
+        if (ksp_type == PIPELINED_KSP_TYPES[k]) return true;
+    }
+    return false;
+} // is_pipelined_ksp_type
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -105,7 +122,15 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_nullspace_constant_vec(NULL),
       d_petsc_nullspace_constant_vec(NULL),
       d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false),
+      d_num_extrapolation_vecs(0),
+      d_num_recycled_vecs(0),
+      d_extrapolation_vecs(),
+      d_recycled_vecs(),
+      d_recycled_op_vecs(),
+      d_num_solves(0),
+      d_total_iterations(0),
+      d_total_solve_time(0.0)
 {
     // Setup default values.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
@@ -128,6 +153,9 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("num_extrapolation_vecs"))
+            d_num_extrapolation_vecs = input_db->getInteger("num_extrapolation_vecs");
+        if (input_db->keyExists("num_recycled_vecs")) d_num_recycled_vecs = input_db->getInteger("num_recycled_vecs");
     }
 
     // Common constructor functionality.
@@ -151,7 +179,15 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
       d_nullspace_constant_vec(NULL),
       d_petsc_nullspace_constant_vec(NULL),
       d_petsc_nullspace_basis_vecs(),
-      d_solver_has_attached_nullspace(false)
+      d_solver_has_attached_nullspace(false),
+      d_num_extrapolation_vecs(0),
+      d_num_recycled_vecs(0),
+      d_extrapolation_vecs(),
+      d_recycled_vecs(),
+      d_recycled_op_vecs(),
+      d_num_solves(0),
+      d_total_iterations(0),
+      d_total_solve_time(0.0)
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
     if (d_petsc_ksp) resetWrappedKSP(d_petsc_ksp);
@@ -255,12 +291,33 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->modifyRhsForBcs(*d_b);
     d_A->setHomogeneousBc(true);
+    const double solve_start_time = MPI_Wtime();
+    const bool modified_initial_guess = computeInitialGuess(x, d_initial_guess_nonzero);
+    if (modified_initial_guess)
+    {
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
     ierr = KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     IBTK_CHKERRQ(ierr);
+    if (modified_initial_guess)
+    {
+        ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, d_initial_guess_nonzero ? PETSC_TRUE : PETSC_FALSE);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Determine the convergence reason.  Only converged solutions are used to
+    // construct subsequent initial guesses.
+    KSPConvergedReason reason;
+    ierr = KSPGetConvergedReason(d_petsc_ksp, &reason);
+    IBTK_CHKERRQ(ierr);
+    const bool converged = (static_cast<int>(reason) > 0);
+    if (converged) updateSolutionHistory(x);
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->imposeSolBcs(x);
+    const double solve_time = MPI_Wtime() - solve_start_time;
 
     // Get iterations count and residual norm.
     ierr = KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
@@ -269,11 +326,21 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     IBTK_CHKERRQ(ierr);
     d_A->setHomogeneousBc(d_homogeneous_bc);
 
-    // Determine the convergence reason.
-    KSPConvergedReason reason;
-    ierr = KSPGetConvergedReason(d_petsc_ksp, &reason);
-    IBTK_CHKERRQ(ierr);
-    const bool converged = (static_cast<int>(reason) > 0);
+    // Update solver statistics.
+    d_num_solves += 1;
+    d_total_iterations += d_current_iterations;
+    d_total_solve_time += solve_time;
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): iterations = " << d_current_iterations
+             << ", solve time = " << solve_time << " s\n"
+             << d_object_name << "::solveSystem(): average iterations = "
+             << static_cast<double>(d_total_iterations) / static_cast<double>(d_num_solves)
+             << ", average solve time = " << d_total_solve_time / static_cast<double>(d_num_solves) << " s over "
+             << d_num_solves << " solves\n";
+    }
+
+    // Report the convergence reason.
     if (d_enable_logging) reportKSPConvergedReason(reason, plog);
 
     // Dealocate scratch data.
@@ -451,6 +518,10 @@ PETScKrylovLinearSolver::deallocateSolverState()
     // Deallocate the nullspace object.
     deallocateNullspaceData();
 
+    // Discard previously computed solutions, which are not valid if the
+    // hierarchy configuration changes.
+    deallocateSolutionHistory();
+
     // Destroy the KSP solver.
     if (d_managing_petsc_ksp)
     {
@@ -618,11 +689,22 @@ PETScKrylovLinearSolver::resetKSPOptions()
     ierr = KSPSetType(d_petsc_ksp, ksp_type);
     IBTK_CHKERRQ(ierr);
     std::string ksp_type_name(ksp_type);
-    if (ksp_type_name.find("gmres") != std::string::npos)
+    const bool pipelined_ksp_type = is_pipelined_ksp_type(ksp_type_name);
+    if (ksp_type_name.find("gmres") != std::string::npos && !pipelined_ksp_type)
     {
         ierr = KSPGMRESSetCGSRefinementType(d_petsc_ksp, KSP_GMRES_CGS_REFINE_IFNEEDED);
         IBTK_CHKERRQ(ierr);
     }
+#if !defined(PETSC_HAVE_MPI_IALLREDUCE) && !defined(PETSC_HAVE_MPIX_IALLREDUCE)
+    if (pipelined_ksp_type)
+    {
+        IBTK_DO_ONCE(TBOX_WARNING(d_object_name << "::resetKSPOptions():\n"
+                                                << "  KSP type " << ksp_type_name << " requested, but PETSc was not\n"
+                                                << "  configured with nonblocking MPI reductions; global reductions\n"
+                                                << "  will not be overlapped with operator applications."
+                                                << std::endl));
+    }
+#endif
     PetscBool initial_guess_nonzero = (d_initial_guess_nonzero ? PETSC_TRUE : PETSC_FALSE);
     ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, initial_guess_nonzero);
     IBTK_CHKERRQ(ierr);
@@ -826,6 +908,148 @@ PETScKrylovLinearSolver::deallocateNullspaceData()
     return;
 } // deallocateNullspaceData
 
+bool
+PETScKrylovLinearSolver::computeInitialGuess(SAMRAIVectorReal<NDIM, double>& x, const bool initial_guess_nonzero)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    bool modified_initial_guess = false;
+    bool nonzero_initial_guess = initial_guess_nonzero;
+
+    // Extrapolate the initial guess from the most recent solutions.  The
+    // coefficients of the polynomial extrapolation through n equally spaced
+    // solutions are (-1)^k (n choose k+1), k = 0, ..., n-1.
+    const int n_extrapolation_vecs = static_cast<int>(d_extrapolation_vecs.size());
+    if (n_extrapolation_vecs > 0)
+    {
+        x.setToScalar(0.0);
+        double binomial_coef = n_extrapolation_vecs;
+        for (int k = 0; k < n_extrapolation_vecs; ++k)
+        {
+            const double alpha = (k % 2 == 0 ? +1.0 : -1.0) * binomial_coef;
+            x.axpy(alpha, d_extrapolation_vecs[k], x_ptr);
+            binomial_coef *= static_cast<double>(n_extrapolation_vecs - k - 1) / static_cast<double>(k + 2);
+        }
+        modified_initial_guess = true;
+        nonzero_initial_guess = true;
+    }
+
+    // Correct the initial guess by projecting the initial residual onto the
+    // recycled subspace: x_0 := x_0 + X (AX)^T (b - A x_0).
+    const int n_recycled_vecs = static_cast<int>(d_recycled_vecs.size());
+    if (n_recycled_vecs > 0)
+    {
+        Pointer<SAMRAIVectorReal<NDIM, double> > r = d_b->cloneVector(d_b->getName());
+        r->allocateVectorData();
+        if (nonzero_initial_guess)
+        {
+            Pointer<SAMRAIVectorReal<NDIM, double> > x0 = d_x->cloneVector(d_x->getName());
+            x0->allocateVectorData();
+            x0->copyVector(x_ptr);
+            d_A->apply(*x0, *r);
+            r->subtract(d_b, r);
+            x0->freeVectorComponents();
+        }
+        else
+        {
+            x.setToScalar(0.0);
+            r->copyVector(d_b);
+        }
+        for (int k = 0; k < n_recycled_vecs; ++k)
+        {
+            const double alpha = r->dot(d_recycled_op_vecs[k]);
+            x.axpy(alpha, d_recycled_vecs[k], x_ptr);
+        }
+        r->freeVectorComponents();
+        modified_initial_guess = true;
+    }
+    return modified_initial_guess;
+} // computeInitialGuess
+
+void
+PETScKrylovLinearSolver::updateSolutionHistory(SAMRAIVectorReal<NDIM, double>& x)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+
+    // Store the solution for extrapolation, reusing the storage of the oldest
+    // solution once the history is full.
+    if (d_num_extrapolation_vecs > 0)
+    {
+        Pointer<SAMRAIVectorReal<NDIM, double> > x_prev;
+        if (static_cast<int>(d_extrapolation_vecs.size()) >= d_num_extrapolation_vecs)
+        {
+            x_prev = d_extrapolation_vecs.back();
+            d_extrapolation_vecs.pop_back();
+        }
+        else
+        {
+            x_prev = x.cloneVector(x.getName());
+            x_prev->allocateVectorData();
+        }
+        x_prev->copyVector(x_ptr);
+        d_extrapolation_vecs.push_front(x_prev);
+    }
+
+    // Add the solution to the recycled subspace.  The new vector is
+    // orthogonalized against the existing subspace via modified Gram-Schmidt so
+    // that the vectors AX remain orthonormal; solutions that are (nearly)
+    // contained in the subspace are not added.
+    if (d_num_recycled_vecs > 0)
+    {
+        Pointer<SAMRAIVectorReal<NDIM, double> > v = x.cloneVector(x.getName());
+        v->allocateVectorData();
+        v->copyVector(x_ptr);
+        Pointer<SAMRAIVectorReal<NDIM, double> > w = d_b->cloneVector(d_b->getName());
+        w->allocateVectorData();
+        d_A->apply(*v, *w);
+        const double w_norm = w->L2Norm();
+        for (unsigned int k = 0; k < d_recycled_vecs.size(); ++k)
+        {
+            const double alpha = w->dot(d_recycled_op_vecs[k]);
+            w->axpy(-alpha, d_recycled_op_vecs[k], w);
+            v->axpy(-alpha, d_recycled_vecs[k], v);
+        }
+        const double w_orth_norm = w->L2Norm();
+        if (w_orth_norm > sqrt(std::numeric_limits<double>::epsilon()) * w_norm)
+        {
+            v->scale(1.0 / w_orth_norm, v);
+            w->scale(1.0 / w_orth_norm, w);
+            if (static_cast<int>(d_recycled_vecs.size()) >= d_num_recycled_vecs)
+            {
+                d_recycled_vecs.back()->freeVectorComponents();
+                d_recycled_vecs.pop_back();
+                d_recycled_op_vecs.back()->freeVectorComponents();
+                d_recycled_op_vecs.pop_back();
+            }
+            d_recycled_vecs.push_front(v);
+            d_recycled_op_vecs.push_front(w);
+        }
+        else
+        {
+            v->freeVectorComponents();
+            w->freeVectorComponents();
+        }
+    }
+    return;
+} // updateSolutionHistory
+
+void
+PETScKrylovLinearSolver::deallocateSolutionHistory()
+{
+    for (unsigned int k = 0; k < d_extrapolation_vecs.size(); ++k)
+    {
+        d_extrapolation_vecs[k]->freeVectorComponents();
+    }
+    d_extrapolation_vecs.clear();
+    for (unsigned int k = 0; k < d_recycled_vecs.size(); ++k)
+    {
+        d_recycled_vecs[k]->freeVectorComponents();
+        d_recycled_op_vecs[k]->freeVectorComponents();
+    }
+    d_recycled_vecs.clear();
+    d_recycled_op_vecs.clear();
+    return;
+} // deallocateSolutionHistory
+
 PetscErrorCode
 PETScKrylovLinearSolver::MatVecMult_SAMRAI(Mat A, Vec x, Vec y)
 {
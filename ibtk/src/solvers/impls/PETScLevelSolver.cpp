@@ -38,9 +38,12 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "BoxArray.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SAMRAIVectorReal.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LinearSolver.h"
@@ -130,6 +133,7 @@ generate_petsc_is_from_std_is(std::vector<std::set<int> >& overlap_std,
 PETScLevelSolver::PETScLevelSolver()
     : d_hierarchy(),
       d_level_num(-1),
+      d_reuse_operator_structure(false),
       d_ksp_type(KSPGMRES),
       d_shell_pc_type(""),
       d_options_prefix(""),
@@ -137,7 +141,9 @@ PETScLevelSolver::PETScLevelSolver()
       d_petsc_mat(NULL),
       d_petsc_pc(NULL),
       d_petsc_x(NULL),
-      d_petsc_b(NULL)
+      d_petsc_b(NULL),
+      d_cached_hierarchy(),
+      d_cached_level_num(-1)
 {
     // Setup default options.
     d_max_iterations = 10000;
@@ -169,6 +175,11 @@ PETScLevelSolver::~PETScLevelSolver()
     }
 
     int ierr;
+    if (d_petsc_mat)
+    {
+        ierr = MatDestroy(&d_petsc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
     for (size_t i = 0; i < d_nonoverlap_is.size(); ++i)
     {
         ierr = ISDestroy(&d_nonoverlap_is[i]);
@@ -350,6 +361,13 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
+    // Discard the retained level operator if the patch level has changed.
+    if (d_petsc_mat && !levelOperatorIsReusable())
+    {
+        int ierr = MatDestroy(&d_petsc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+
     // Perform specialized operations to initialize solver state();
     initializeSolverStateSpecialized(x, b);
 
@@ -668,13 +686,25 @@ PETScLevelSolver::deallocateSolverState()
         ierr = MatDestroy(&d_petsc_pc);
         IBTK_CHKERRQ(ierr);
     }
-    ierr = MatDestroy(&d_petsc_mat);
-    IBTK_CHKERRQ(ierr);
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty())
     {
+        ierr = MatSetNullSpace(d_petsc_mat, NULL);
+        IBTK_CHKERRQ(ierr);
         ierr = MatNullSpaceDestroy(&d_petsc_nullsp);
         IBTK_CHKERRQ(ierr);
     }
+    if (d_reuse_operator_structure)
+    {
+        // Retain the level operator so that its nonzero structure may be reused
+        // if the solver is reinitialized on the same patch level.
+        cacheLevelOperatorConfiguration();
+    }
+    else
+    {
+        ierr = MatDestroy(&d_petsc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_petsc_pc = NULL;
     ierr = VecDestroy(&d_petsc_x);
     IBTK_CHKERRQ(ierr);
     ierr = VecDestroy(&d_petsc_b);
@@ -726,7 +756,6 @@ PETScLevelSolver::deallocateSolverState()
     }
 
     d_petsc_ksp = NULL;
-    d_petsc_mat = NULL;
     d_petsc_x = NULL;
     d_petsc_b = NULL;
 
@@ -759,6 +788,8 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
             input_db->getIntegerArray("subdomain_box_size", d_box_size, NDIM);
         if (input_db->keyExists("subdomain_overlap_size"))
             input_db->getIntegerArray("subdomain_overlap_size", d_overlap_size, NDIM);
+        if (input_db->keyExists("reuse_operator_structure"))
+            d_reuse_operator_structure = input_db->getBool("reuse_operator_structure");
     }
     return;
 } // init
@@ -817,6 +848,40 @@ PETScLevelSolver::setupNullspace()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+PETScLevelSolver::levelOperatorIsReusable() const
+{
+    if (d_hierarchy.getPointer() != d_cached_hierarchy.getPointer() || d_level_num != d_cached_level_num)
+    {
+        return false;
+    }
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const ProcessorMapping& mapping = d_level->getProcessorMapping();
+    if (boxes.getNumberOfBoxes() != static_cast<int>(d_cached_boxes.size())) return false;
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        if (!(boxes[i] == d_cached_boxes[i]) || mapping.getProcessorAssignment(i) != d_cached_mapping[i]) return false;
+    }
+    return true;
+} // levelOperatorIsReusable
+
+void
+PETScLevelSolver::cacheLevelOperatorConfiguration()
+{
+    d_cached_hierarchy = d_hierarchy;
+    d_cached_level_num = d_level_num;
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const ProcessorMapping& mapping = d_level->getProcessorMapping();
+    d_cached_boxes.resize(boxes.getNumberOfBoxes());
+    d_cached_mapping.resize(boxes.getNumberOfBoxes());
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        d_cached_boxes[i] = boxes[i];
+        d_cached_mapping[i] = mapping.getProcessorAssignment(i);
+    }
+    return;
+} // cacheLevelOperatorConfiguration
+
 PetscErrorCode
 PETScLevelSolver::PCApply_Additive(PC pc, Vec x, Vec y)
 {
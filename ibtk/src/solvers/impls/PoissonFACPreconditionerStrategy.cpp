@@ -173,6 +173,10 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("num_geometric_coarse_levels"))
+            d_num_geometric_coarse_levels = input_db->getInteger("num_geometric_coarse_levels");
+        if (input_db->keyExists("geometric_coarse_level_min_box_size"))
+            setGeometricCoarseLevelMinBoxSize(input_db->getInteger("geometric_coarse_level_min_box_size"));
     }
 
     // Setup scratch variables.
@@ -134,8 +134,14 @@ SCPoissonPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorRe
     IBTK_CHKERRQ(ierr);
     ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_b);
     IBTK_CHKERRQ(ierr);
-    PETScMatUtilities::constructPatchLevelSCLaplaceOp(
-        d_petsc_mat, d_poisson_spec, d_bc_coefs, d_solution_time, d_num_dofs_per_proc, d_dof_index_idx, d_level);
+    PETScMatUtilities::constructPatchLevelSCLaplaceOp(d_petsc_mat,
+                                                      d_poisson_spec,
+                                                      d_bc_coefs,
+                                                      d_solution_time,
+                                                      d_num_dofs_per_proc,
+                                                      d_dof_index_idx,
+                                                      d_level,
+                                                      d_reuse_operator_structure);
     d_petsc_pc = d_petsc_mat;
     PETScMatUtilities::constructPatchLevelASMSubdomains(d_overlap_is,
                                                         d_nonoverlap_is,
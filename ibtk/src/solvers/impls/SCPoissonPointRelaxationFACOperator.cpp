@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <math.h>
 #include <stddef.h>
 #include <algorithm>
 #include <map>
@@ -98,12 +99,16 @@
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#define JACOBI_SMOOTH_FC IBTK_FC_FUNC(jacobismooth2d, JACOBISMOOTH2D)
+#define JACOBI_SMOOTH_MASK_FC IBTK_FC_FUNC(jacobismoothmask2d, JACOBISMOOTHMASK2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#define JACOBI_SMOOTH_FC IBTK_FC_FUNC(jacobismooth3d, JACOBISMOOTH3D)
+#define JACOBI_SMOOTH_MASK_FC IBTK_FC_FUNC(jacobismoothmask3d, JACOBISMOOTHMASK3D)
 #endif
 
 // Function interfaces
@@ -177,6 +182,48 @@ void RB_GS_SMOOTH_MASK_FC(double* U,
 #endif
                           const double* dx,
                           const int& red_or_black);
+
+void JACOBI_SMOOTH_FC(double* U,
+                      const int& U_gcw,
+                      const double& alpha,
+                      const double& beta,
+                      const double* F,
+                      const int& F_gcw,
+                      double* D,
+                      const int& D_gcw,
+                      const double& omega,
+                      const double& gamma,
+                      const int& ilower0,
+                      const int& iupper0,
+                      const int& ilower1,
+                      const int& iupper1,
+#if (NDIM == 3)
+                      const int& ilower2,
+                      const int& iupper2,
+#endif
+                      const double* dx);
+
+void JACOBI_SMOOTH_MASK_FC(double* U,
+                           const int& U_gcw,
+                           const double& alpha,
+                           const double& beta,
+                           const double* F,
+                           const int& F_gcw,
+                           double* D,
+                           const int& D_gcw,
+                           const int* mask,
+                           const int& mask_gcw,
+                           const double& omega,
+                           const double& gamma,
+                           const int& ilower0,
+                           const int& iupper0,
+                           const int& ilower1,
+                           const int& iupper1,
+#if (NDIM == 3)
+                           const int& ilower2,
+                           const int& iupper2,
+#endif
+                           const double* dx);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -217,6 +264,8 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    L1_JACOBI,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -225,8 +274,10 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "L1_JACOBI") return L1_JACOBI;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -256,6 +307,35 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+inline bool
+use_jacobi_iteration(SmootherType smoother_type)
+{
+    if (smoother_type == L1_JACOBI || smoother_type == CHEBYSHEV)
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+} // use_jacobi_iteration
+
+// Compute the diagonal entry and the sum of the magnitudes of the off-diagonal
+// entries of the standard (2*NDIM+1)-point discretization of alpha div grad +
+// beta.
+inline void
+get_operator_diagonal(double& diag, double& off_diag_sum, const double alpha, const double beta, const double* const dx)
+{
+    double fac_sum = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac_sum += 1.0 / (dx[d] * dx[d]);
+    }
+    diag = beta - 2.0 * alpha * fac_sum;
+    off_diag_sum = 2.0 * fabs(alpha) * fac_sum;
+    return;
+} // get_operator_diagonal
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -271,6 +351,9 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
           default_options_prefix),
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
+      d_chebyshev_lower_eig_factor(0.1),
+      d_chebyshev_upper_eig_factor(1.1),
+      d_chebyshev_max_eig(),
       d_patch_bc_box_overlap(),
       d_patch_neighbor_overlap()
 {
@@ -290,6 +373,10 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
     if (input_db)
     {
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("chebyshev_lower_eig_factor"))
+            d_chebyshev_lower_eig_factor = input_db->getDouble("chebyshev_lower_eig_factor");
+        if (input_db->keyExists("chebyshev_upper_eig_factor"))
+            d_chebyshev_upper_eig_factor = input_db->getDouble("chebyshev_upper_eig_factor");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -362,6 +449,18 @@ SCPoissonPointRelaxationFACOperator::setSmootherType(const std::string& smoother
     return;
 } // setSmootherType
 
+void
+SCPoissonPointRelaxationFACOperator::setChebyshevEigenvalueFactors(const double lower_eig_factor,
+                                                                   const double upper_eig_factor)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0.0 < lower_eig_factor && lower_eig_factor < upper_eig_factor);
+#endif
+    d_chebyshev_lower_eig_factor = lower_eig_factor;
+    d_chebyshev_upper_eig_factor = upper_eig_factor;
+    return;
+} // setChebyshevEigenvalueFactors
+
 void
 SCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coarse_solver_type)
 {
@@ -407,6 +506,21 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
+    const bool jacobi_iteration = use_jacobi_iteration(smoother_type);
+
+    // Determine the parameters of the Chebyshev iteration.
+    //
+    // NOTE: The update direction used by the Jacobi-type smoothers is stored in
+    // the interior of the "scratch" data, which otherwise is used only to cache
+    // ghost cell values.
+    double chebyshev_theta = 0.0, chebyshev_delta = 0.0, chebyshev_rho = 0.0;
+    if (smoother_type == CHEBYSHEV)
+    {
+        const double max_eig = d_chebyshev_upper_eig_factor * d_chebyshev_max_eig[level_num];
+        const double min_eig = d_chebyshev_lower_eig_factor * d_chebyshev_max_eig[level_num];
+        chebyshev_theta = 0.5 * (max_eig + min_eig);
+        chebyshev_delta = 0.5 * (max_eig - min_eig);
+    }
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
@@ -436,6 +550,25 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     if (red_black_ordering) num_sweeps *= 2;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
+        // Determine the coefficients of the Jacobi-type update.
+        double omega_fac = 1.0, gamma_fac = 0.0;
+        if (smoother_type == CHEBYSHEV)
+        {
+            const double sigma = chebyshev_theta / chebyshev_delta;
+            if (isweep == 0)
+            {
+                omega_fac = 1.0 / chebyshev_theta;
+                chebyshev_rho = 1.0 / sigma;
+            }
+            else
+            {
+                const double rho_new = 1.0 / (2.0 * sigma - chebyshev_rho);
+                omega_fac = 2.0 * rho_new / chebyshev_delta;
+                gamma_fac = rho_new * chebyshev_rho;
+                chebyshev_rho = rho_new;
+            }
+        }
+
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
@@ -530,9 +663,19 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 d_bc_helper->copyDataAtDirichletBoundaries(error_data, residual_data, patch);
             }
 
-            // Smooth the error using Gauss-Seidel.
+            // Smooth the error.
             const double& alpha = d_poisson_spec.getDConstant();
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+            Pointer<SideData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+            double omega = 0.0;
+            if (jacobi_iteration)
+            {
+                double diag, off_diag_sum;
+                get_operator_diagonal(diag, off_diag_sum, alpha, beta, dx);
+                omega = omega_fac / diag;
+                if (smoother_type == L1_JACOBI) omega = 1.0 / (diag + (diag < 0.0 ? -off_diag_sum : off_diag_sum));
+                if (isweep == 0) scratch_data->fillAll(0.0, patch_box);
+            }
             for (int axis = 0; axis < NDIM; ++axis)
             {
                 const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
@@ -544,9 +687,35 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const int F_ghosts = (residual_data->getGhostCellWidth()).max();
                     const int* const mask = mask_data->getPointer(axis, depth);
                     const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
+                    double* const D = scratch_data->getPointer(axis, depth);
+                    const int D_ghosts = (scratch_data->getGhostCellWidth()).max();
                     if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
                     {
-                        if (red_black_ordering)
+                        if (jacobi_iteration)
+                        {
+                            JACOBI_SMOOTH_MASK_FC(U,
+                                                  U_ghosts,
+                                                  alpha,
+                                                  beta,
+                                                  F,
+                                                  F_ghosts,
+                                                  D,
+                                                  D_ghosts,
+                                                  mask,
+                                                  mask_ghosts,
+                                                  omega,
+                                                  gamma_fac,
+                                                  side_patch_box.lower(0),
+                                                  side_patch_box.upper(0),
+                                                  side_patch_box.lower(1),
+                                                  side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                  side_patch_box.lower(2),
+                                                  side_patch_box.upper(2),
+#endif
+                                                  dx);
+                        }
+                        else if (red_black_ordering)
                         {
                             int red_or_black = isweep % 2; // "red" = 0, "black" = 1
                             RB_GS_SMOOTH_MASK_FC(U,
@@ -591,7 +760,29 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     }
                     else
                     {
-                        if (red_black_ordering)
+                        if (jacobi_iteration)
+                        {
+                            JACOBI_SMOOTH_FC(U,
+                                             U_ghosts,
+                                             alpha,
+                                             beta,
+                                             F,
+                                             F_ghosts,
+                                             D,
+                                             D_ghosts,
+                                             omega,
+                                             gamma_fac,
+                                             side_patch_box.lower(0),
+                                             side_patch_box.upper(0),
+                                             side_patch_box.lower(1),
+                                             side_patch_box.upper(1),
+#if (NDIM == 3)
+                                             side_patch_box.lower(2),
+                                             side_patch_box.upper(2),
+#endif
+                                             dx);
+                        }
+                        else if (red_black_ordering)
                         {
                             int red_or_black = isweep % 2; // "red" = 0, "black" = 1
                             RB_GS_SMOOTH_FC(U,
@@ -658,10 +849,20 @@ SCPoissonPointRelaxationFACOperator::solveCoarsestLevel(SAMRAIVectorReal<NDIM, d
         d_coarse_solver->setMaxIterations(d_coarse_solver_max_iterations);
         d_coarse_solver->setAbsoluteTolerance(d_coarse_solver_abs_residual_tol);
         d_coarse_solver->setRelativeTolerance(d_coarse_solver_rel_residual_tol);
-        LinearSolver* p_coarse_solver = dynamic_cast<LinearSolver*>(d_coarse_solver.getPointer());
-        if (p_coarse_solver) p_coarse_solver->setInitialGuessNonzero(true);
-        d_coarse_solver->solveSystem(*getLevelSAMRAIVectorReal(error, d_coarsest_ln),
-                                     *getLevelSAMRAIVectorReal(residual, d_coarsest_ln));
+        if (d_geometric_coarse_hierarchy)
+        {
+            // Solve on level 0 and the geometric coarse levels below it.
+            copyToGeometricCoarseLevels(error, residual, coarsest_ln);
+            d_coarse_solver->solveSystem(*d_geometric_coarse_solution, *d_geometric_coarse_rhs);
+            copyFromGeometricCoarseLevels(error, coarsest_ln);
+        }
+        else
+        {
+            LinearSolver* p_coarse_solver = dynamic_cast<LinearSolver*>(d_coarse_solver.getPointer());
+            if (p_coarse_solver) p_coarse_solver->setInitialGuessNonzero(true);
+            d_coarse_solver->solveSystem(*getLevelSAMRAIVectorReal(error, d_coarsest_ln),
+                                         *getLevelSAMRAIVectorReal(residual, d_coarsest_ln));
+        }
         xeqScheduleDataSynch(error.getComponentDescriptorIndex(0), coarsest_ln);
     }
     else
@@ -781,6 +982,28 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
 
+    // Bound the largest eigenvalue of the diagonally scaled operator on each
+    // level (as required by the Chebyshev smoother) via Gershgorin's theorem.
+    // For the constant-coefficient operators treated by this class, this bound
+    // is sharp as the grid is refined.
+    d_chebyshev_max_eig.resize(d_finest_ln + 1, 0.0);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const double alpha = d_poisson_spec.getDConstant();
+    const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        double dx[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        }
+        double diag, off_diag_sum;
+        get_operator_diagonal(diag, off_diag_sum, alpha, beta, dx);
+        d_chebyshev_max_eig[ln] = 1.0 + off_diag_sum / fabs(diag);
+    }
+
     // Setup cached BC data.
     d_bc_helper = new StaggeredPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
@@ -801,8 +1024,26 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         d_coarse_solver->setPoissonSpecifications(d_poisson_spec);
         d_coarse_solver->setPhysicalBcCoefs(d_bc_coefs);
         d_coarse_solver->setHomogeneousBc(true);
-        d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
-                                               *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        if (d_coarsest_ln == 0 && d_num_geometric_coarse_levels > 0)
+        {
+            const bool coefs_are_constant =
+                (d_poisson_spec.cIsConstant() || d_poisson_spec.cIsZero()) && d_poisson_spec.dIsConstant();
+            initializeGeometricCoarseLevels(*d_solution,
+                                            *d_rhs,
+                                            d_coarsest_ln,
+                                            d_num_geometric_coarse_levels,
+                                            d_coarse_solver.getPointer(),
+                                            coefs_are_constant);
+        }
+        if (d_geometric_coarse_hierarchy)
+        {
+            d_coarse_solver->initializeSolverState(*d_geometric_coarse_solution, *d_geometric_coarse_rhs);
+        }
+        else
+        {
+            d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
+                                                   *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        }
     }
 
     // Setup specialized transfer operators.
@@ -895,9 +1136,11 @@ SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
 
     if (!d_in_initialize_operator_state)
     {
+        d_chebyshev_max_eig.clear();
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
+        deallocateGeometricCoarseLevels();
     }
     return;
 } // deallocateOperatorStateSpecialized
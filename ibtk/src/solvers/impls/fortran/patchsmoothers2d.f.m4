@@ -40,6 +40,7 @@ c     SUCH DAMAGE.
 c
 define(NDIM,2)dnl
 define(REAL,`double precision')dnl
+define(SP_REAL,`real')dnl
 define(INTEGER,`integer')dnl
 include(SAMRAI_FORTDIR/pdat_m4arrdim2d.i)dnl
 c
@@ -304,3 +305,370 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single Jacobi-type sweep for F = alpha div grad U +
+c     beta U.
+c
+c     The update direction D is set to gamma D + omega (F - (alpha div
+c     grad U + beta U)), and then U is set to U + D.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine jacobismooth2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     D,D_gcw,
+     &     omega,gamma,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw,D_gcw
+
+      REAL alpha,beta
+      REAL omega,gamma
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &       ilower1-D_gcw:iupper1+D_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,diag
+c
+c     Compute the update direction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      diag = beta-2.d0*(fac0+fac1)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            D(i0,i1) = gamma*D(i0,i1) + omega*(F(i0,i1) - (
+     &         fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &         fac1*(U(i0,i1-1)+U(i0,i1+1)) +
+     &         diag*U(i0,i1)))
+         enddo
+      enddo
+c
+c     Update the solution.
+c
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            U(i0,i1) = U(i0,i1) + D(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single Jacobi-type sweep for F = alpha div grad U +
+c     beta U with masking of certain degrees of freedom.
+c
+c     The update direction D is set to gamma D + omega (F - (alpha div
+c     grad U + beta U)), and then U is set to U + D.
+c
+c     NOTE: The solution U is unmodified at masked degrees of freedom.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine jacobismoothmask2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     D,D_gcw,
+     &     mask,mask_gcw,
+     &     omega,gamma,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw,D_gcw,mask_gcw
+
+      REAL alpha,beta
+      REAL omega,gamma
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &             ilower1-mask_gcw:iupper1+mask_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &       ilower1-D_gcw:iupper1+D_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,diag
+c
+c     Compute the update direction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      diag = beta-2.d0*(fac0+fac1)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            if (mask(i0,i1) .eq. 0) then
+               D(i0,i1) = gamma*D(i0,i1) + omega*(F(i0,i1) - (
+     &            fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &            fac1*(U(i0,i1-1)+U(i0,i1+1)) +
+     &            diag*U(i0,i1)))
+            else
+               D(i0,i1) = 0.d0
+            endif
+         enddo
+      enddo
+c
+c     Update the solution.
+c
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            U(i0,i1) = U(i0,i1) + D(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
+c     beta U.
+c
+c     The solution and right-hand side are stored in single precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine gssmoothsp2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw
+
+      REAL alpha,beta
+
+      SP_REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      SP_REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      SP_REAL fac0,fac1,fac
+c
+c     Perform a single Gauss-Seidel sweep.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            U(i0,i1) = fac*(
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &           F(i0,i1))
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = alpha
+c     div grad U + beta U.
+c
+c     The solution and right-hand side are stored in single precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine rbgssmoothsp2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     red_or_black)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw
+      INTEGER red_or_black
+
+      REAL alpha,beta
+
+      SP_REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      SP_REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      SP_REAL fac0,fac1,fac
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep.
+c
+      red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
+
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            if ( mod(i0+i1,2) .eq. red_or_black ) then
+               U(i0,i1) = fac*(
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1))
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single Jacobi-type sweep for F = alpha div grad U +
+c     beta U.
+c
+c     The update direction D is set to gamma D + omega (F - (alpha div
+c     grad U + beta U)), and then U is set to U + D.
+c
+c     The solution, right-hand side, and update direction are stored
+c     in single precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine jacobismoothsp2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     D,D_gcw,
+     &     omega,gamma,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw,D_gcw
+
+      REAL alpha,beta
+      REAL omega,gamma
+
+      SP_REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      SP_REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+
+      SP_REAL D(ilower0-D_gcw:iupper0+D_gcw,
+     &       ilower1-D_gcw:iupper1+D_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      SP_REAL fac0,fac1,diag
+      SP_REAL w,g
+c
+c     Compute the update direction.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      w = omega
+      g = gamma
+      diag = beta-2.d0*(fac0+fac1)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            D(i0,i1) = g*D(i0,i1) + w*(F(i0,i1) - (
+     &         fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &         fac1*(U(i0,i1-1)+U(i0,i1+1)) +
+     &         diag*U(i0,i1)))
+         enddo
+      enddo
+c
+c     Update the solution.
+c
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            U(i0,i1) = U(i0,i1) + D(i0,i1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -32,19 +32,31 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
 
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxList.h"
+#include "GridGeometry.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SAMRAIVectorReal.h"
 #include "ibtk/FACPreconditioner.h"
 #include "ibtk/FACPreconditionerStrategy.h"
+#include "ibtk/GeneralSolver.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/ConstPointer.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -52,6 +64,62 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Determine whether all of the boxes can be coarsened by the specified ratio
+// without changing the region that they cover.
+inline bool
+can_coarsen_boxes(const BoxArray<NDIM>& boxes, const IntVector<NDIM>& ratio)
+{
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        const Box<NDIM>& box = boxes[i];
+        if (!(Box<NDIM>::refine(Box<NDIM>::coarsen(box, ratio), ratio) == box)) return false;
+    }
+    return true;
+} // can_coarsen_boxes
+
+// Determine whether all of the boxes are at least min_box_size cells wide in
+// each coordinate direction.
+inline bool
+boxes_are_large_enough(const BoxArray<NDIM>& boxes, const int min_box_size)
+{
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        if (boxes[i].numberCells().min() < min_box_size) return false;
+    }
+    return true;
+} // boxes_are_large_enough
+
+// Chop the box into boxes that are min_box_size cells wide in each coordinate
+// direction.  Any remainder is merged into the last box in that direction.
+void
+chop_box(BoxList<NDIM>& boxes, const Box<NDIM>& box, const int min_box_size)
+{
+    int num_chunks[NDIM];
+    int num_boxes = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        num_chunks[d] = std::max(1, box.numberCells(d) / min_box_size);
+        num_boxes *= num_chunks[d];
+    }
+    for (int k = 0; k < num_boxes; ++k)
+    {
+        Box<NDIM> chunk(box);
+        int r = k;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int i = r % num_chunks[d];
+            r /= num_chunks[d];
+            chunk.lower(d) = box.lower(d) + i * min_box_size;
+            if (i + 1 < num_chunks[d]) chunk.upper(d) = chunk.lower(d) + min_box_size - 1;
+        }
+        boxes.appendItem(chunk);
+    }
+    return;
+} // chop_box
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FACPreconditionerStrategy::FACPreconditionerStrategy(const std::string& object_name, bool homogeneous_bc)
@@ -60,7 +128,12 @@ FACPreconditionerStrategy::FACPreconditionerStrategy(const std::string& object_n
       d_homogeneous_bc(homogeneous_bc),
       d_solution_time(std::numeric_limits<double>::quiet_NaN()),
       d_current_time(std::numeric_limits<double>::quiet_NaN()),
-      d_new_time(std::numeric_limits<double>::quiet_NaN())
+      d_new_time(std::numeric_limits<double>::quiet_NaN()),
+      d_num_geometric_coarse_levels(0),
+      d_geometric_coarse_level_min_box_size(8),
+      d_geometric_coarse_hierarchy(),
+      d_geometric_coarse_solution(),
+      d_geometric_coarse_rhs()
 {
     // intentionally blank
     return;
@@ -137,6 +210,38 @@ FACPreconditionerStrategy::getDt() const
     return d_new_time - d_current_time;
 } // getDt
 
+void
+FACPreconditionerStrategy::setNumGeometricCoarseLevels(const int num_geometric_coarse_levels)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setNumGeometricCoarseLevels():\n"
+                                 << "  cannot be called while operator state is initialized"
+                                 << std::endl);
+    }
+    d_num_geometric_coarse_levels = num_geometric_coarse_levels;
+    return;
+} // setNumGeometricCoarseLevels
+
+void
+FACPreconditionerStrategy::setGeometricCoarseLevelMinBoxSize(const int min_box_size)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setGeometricCoarseLevelMinBoxSize():\n"
+                                 << "  cannot be called while operator state is initialized"
+                                 << std::endl);
+    }
+    if (min_box_size < 1)
+    {
+        TBOX_ERROR(d_object_name << "::setGeometricCoarseLevelMinBoxSize():\n"
+                                 << "  minimum box size must be positive"
+                                 << std::endl);
+    }
+    d_geometric_coarse_level_min_box_size = min_box_size;
+    return;
+} // setGeometricCoarseLevelMinBoxSize
+
 void
 FACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>& /*solution*/,
                                                    const SAMRAIVectorReal<NDIM, double>& /*rhs*/)
@@ -183,6 +288,174 @@ FACPreconditionerStrategy::getLevelSAMRAIVectorReal(const SAMRAIVectorReal<NDIM,
     return level_vec;
 } // getLevelSAMRAIVectorReal
 
+int
+FACPreconditionerStrategy::initializeGeometricCoarseLevels(const SAMRAIVectorReal<NDIM, double>& solution,
+                                                           const SAMRAIVectorReal<NDIM, double>& rhs,
+                                                           const int level_num,
+                                                           const int num_coarse_levels,
+                                                           const GeneralSolver* const coarse_solver,
+                                                           const bool coefs_are_constant)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_num == 0);
+    TBOX_ASSERT(solution.getNumberOfComponents() == rhs.getNumberOfComponents());
+#endif
+    deallocateGeometricCoarseLevels();
+    if (num_coarse_levels <= 0) return 0;
+    if (!dynamic_cast<const FACPreconditioner*>(coarse_solver))
+    {
+        TBOX_ERROR(d_object_name << "::initializeGeometricCoarseLevels():\n"
+                                 << "  geometric coarse levels require a FAC coarse level solver"
+                                 << std::endl);
+    }
+    if (!coefs_are_constant)
+    {
+        TBOX_ERROR(d_object_name << "::initializeGeometricCoarseLevels():\n"
+                                 << "  geometric coarse levels require constant problem coefficients"
+                                 << std::endl);
+    }
+
+    // Determine how many times the computational domain can be coarsened by a
+    // factor of two, and how many of those coarsenings can reuse the boxes of
+    // the original level before they become smaller than the minimum box size.
+    Pointer<PatchHierarchy<NDIM> > hierarchy = solution.getPatchHierarchy();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
+    Pointer<GridGeometry<NDIM> > grid_geometry = hierarchy->getGridGeometry();
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    const BoxArray<NDIM>& domain_boxes = grid_geometry->getPhysicalDomain();
+    const int min_box_size = d_geometric_coarse_level_min_box_size;
+    int num_levels = 0, num_unagglomerated_levels = 0;
+    while (num_levels < num_coarse_levels)
+    {
+        const IntVector<NDIM> ratio(1 << (num_levels + 1));
+        if (!can_coarsen_boxes(domain_boxes, ratio)) break;
+        ++num_levels;
+        if (num_unagglomerated_levels + 1 == num_levels && can_coarsen_boxes(level_boxes, ratio))
+        {
+            BoxArray<NDIM> boxes(level_boxes);
+            boxes.coarsen(ratio);
+            if (boxes_are_large_enough(boxes, min_box_size)) ++num_unagglomerated_levels;
+        }
+    }
+    if (num_levels == 0) return 0;
+
+    // Build the auxiliary hierarchy.  The finest level shares the boxes and
+    // processor mapping of the original level, so that data can be transferred
+    // between the original level and the finest auxiliary level without
+    // communication.  Coarser levels keep coarsening those boxes until they
+    // would become smaller than the minimum box size.  Below that, the
+    // coarsened physical domain is re-boxed into boxes of the minimum box size,
+    // which are distributed over no more processors than there are boxes.
+    // Data are moved between the auxiliary levels by the transfer schedules of
+    // the FAC coarse level solver.
+    Pointer<GridGeometry<NDIM> > coarse_grid_geometry = grid_geometry->makeCoarsenedGridGeometry(
+        d_object_name + "::geometric_coarse_grid_geometry", IntVector<NDIM>(1 << num_levels), false);
+    d_geometric_coarse_hierarchy =
+        new PatchHierarchy<NDIM>(d_object_name + "::geometric_coarse_hierarchy", coarse_grid_geometry, false);
+    const int nodes = SAMRAI_MPI::getNodes();
+    for (int ln = 0; ln <= num_levels; ++ln)
+    {
+        const IntVector<NDIM> ratio(1 << (num_levels - ln));
+        if (num_levels - ln <= num_unagglomerated_levels)
+        {
+            BoxArray<NDIM> boxes(level_boxes);
+            boxes.coarsen(ratio);
+            d_geometric_coarse_hierarchy->makeNewPatchLevel(
+                ln, IntVector<NDIM>(1 << ln), boxes, level->getProcessorMapping());
+        }
+        else
+        {
+            BoxList<NDIM> box_list;
+            for (int i = 0; i < domain_boxes.getNumberOfBoxes(); ++i)
+            {
+                chop_box(box_list, Box<NDIM>::coarsen(domain_boxes[i], ratio), min_box_size);
+            }
+            const BoxArray<NDIM> boxes(box_list);
+            const int num_boxes = boxes.getNumberOfBoxes();
+            ProcessorMapping mapping(num_boxes);
+            for (int i = 0; i < num_boxes; ++i)
+            {
+                mapping.setProcessorAssignment(i, i % std::min(nodes, num_boxes));
+            }
+            d_geometric_coarse_hierarchy->makeNewPatchLevel(ln, IntVector<NDIM>(1 << ln), boxes, mapping);
+        }
+    }
+
+    // Allocate vectors on the auxiliary hierarchy.
+    d_geometric_coarse_solution = new SAMRAIVectorReal<NDIM, double>(
+        solution.getName() + "::geometric_coarse_levels", d_geometric_coarse_hierarchy, 0, num_levels);
+    d_geometric_coarse_rhs = new SAMRAIVectorReal<NDIM, double>(
+        rhs.getName() + "::geometric_coarse_levels", d_geometric_coarse_hierarchy, 0, num_levels);
+    for (int comp = 0; comp < solution.getNumberOfComponents(); ++comp)
+    {
+        d_geometric_coarse_solution->addComponent(solution.getComponentVariable(comp),
+                                                  solution.getComponentDescriptorIndex(comp));
+        d_geometric_coarse_rhs->addComponent(rhs.getComponentVariable(comp), rhs.getComponentDescriptorIndex(comp));
+    }
+    d_geometric_coarse_solution->allocateVectorData(d_solution_time);
+    d_geometric_coarse_rhs->allocateVectorData(d_solution_time);
+    return num_levels;
+} // initializeGeometricCoarseLevels
+
+void
+FACPreconditionerStrategy::copyToGeometricCoarseLevels(const SAMRAIVectorReal<NDIM, double>& error,
+                                                       const SAMRAIVectorReal<NDIM, double>& residual,
+                                                       const int level_num)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_geometric_coarse_hierarchy);
+#endif
+    Pointer<PatchLevel<NDIM> > level = error.getPatchHierarchy()->getPatchLevel(level_num);
+    Pointer<PatchLevel<NDIM> > aux_level = d_geometric_coarse_hierarchy->getPatchLevel(
+        d_geometric_coarse_hierarchy->getFinestLevelNumber());
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<Patch<NDIM> > aux_patch = aux_level->getPatch(p());
+        for (int comp = 0; comp < error.getNumberOfComponents(); ++comp)
+        {
+            const int aux_e_idx = d_geometric_coarse_solution->getComponentDescriptorIndex(comp);
+            const int aux_r_idx = d_geometric_coarse_rhs->getComponentDescriptorIndex(comp);
+            aux_patch->getPatchData(aux_e_idx)->copy(*patch->getPatchData(error.getComponentDescriptorIndex(comp)));
+            aux_patch->getPatchData(aux_r_idx)->copy(*patch->getPatchData(residual.getComponentDescriptorIndex(comp)));
+        }
+    }
+    return;
+} // copyToGeometricCoarseLevels
+
+void
+FACPreconditionerStrategy::copyFromGeometricCoarseLevels(SAMRAIVectorReal<NDIM, double>& error, const int level_num)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_geometric_coarse_hierarchy);
+#endif
+    Pointer<PatchLevel<NDIM> > level = error.getPatchHierarchy()->getPatchLevel(level_num);
+    Pointer<PatchLevel<NDIM> > aux_level = d_geometric_coarse_hierarchy->getPatchLevel(
+        d_geometric_coarse_hierarchy->getFinestLevelNumber());
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<Patch<NDIM> > aux_patch = aux_level->getPatch(p());
+        for (int comp = 0; comp < error.getNumberOfComponents(); ++comp)
+        {
+            const int aux_e_idx = d_geometric_coarse_solution->getComponentDescriptorIndex(comp);
+            patch->getPatchData(error.getComponentDescriptorIndex(comp))->copy(*aux_patch->getPatchData(aux_e_idx));
+        }
+    }
+    return;
+} // copyFromGeometricCoarseLevels
+
+void
+FACPreconditionerStrategy::deallocateGeometricCoarseLevels()
+{
+    if (d_geometric_coarse_solution) d_geometric_coarse_solution->deallocateVectorData();
+    if (d_geometric_coarse_rhs) d_geometric_coarse_rhs->deallocateVectorData();
+    d_geometric_coarse_solution.setNull();
+    d_geometric_coarse_rhs.setNull();
+    d_geometric_coarse_hierarchy.setNull();
+    return;
+} // deallocateGeometricCoarseLevels
+
 void
 FACPreconditionerStrategy::printClassData(std::ostream& stream)
 {
@@ -192,7 +465,9 @@ FACPreconditionerStrategy::printClassData(std::ostream& stream)
            << "homogeneous_bc = " << d_homogeneous_bc << "\n"
            << "solution_time = " << d_solution_time << "\n"
            << "current_time = " << d_current_time << "\n"
-           << "new_time = " << d_new_time << "\n";
+           << "new_time = " << d_new_time << "\n"
+           << "num_geometric_coarse_levels = " << d_num_geometric_coarse_levels << "\n"
+           << "geometric_coarse_level_min_box_size = " << d_geometric_coarse_level_min_box_size << "\n";
     return;
 } // printClassData
 
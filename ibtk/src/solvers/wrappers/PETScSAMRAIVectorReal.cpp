@@ -35,10 +35,26 @@
 #include <math.h>
 #include <algorithm>
 #include <ostream>
+#include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "NodeData.h"
+#include "NodeGeometry.h"
+#include "NodeVariable.h"
+#include "Patch.h"
+#include "PatchData.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
+#include "Variable.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/NormOps.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
@@ -123,10 +139,288 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// Determine whether all of the components of the vector are of a data
+// centering supported by the fused multi-vector kernels below.
+inline bool
+supports_fused_ops(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
+{
+    const int ncomp = samrai_vector->getNumberOfComponents();
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const Pointer<Variable<NDIM> >& comp_var = samrai_vector->getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = comp_var;
+        Pointer<SideVariable<NDIM, double> > comp_sc_var = comp_var;
+        Pointer<NodeVariable<NDIM, double> > comp_nc_var = comp_var;
+        if (!comp_cc_var && !comp_sc_var && !comp_nc_var) return false;
+    }
+    return true;
+} // supports_fused_ops
+
+// Collect the data arrays of a cell-, side-, or node-centered patch data
+// object, along with the index boxes corresponding to the patch interior.
+inline void
+get_interior_arrays(Pointer<PatchData<NDIM> > data,
+                    const Box<NDIM>& patch_box,
+                    std::vector<ArrayData<NDIM, double>*>& arrays,
+                    std::vector<Box<NDIM> >& boxes)
+{
+    arrays.clear();
+    boxes.clear();
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    if (cc_data)
+    {
+        arrays.push_back(&cc_data->getArrayData());
+        boxes.push_back(patch_box);
+        return;
+    }
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    if (sc_data)
+    {
+        const IntVector<NDIM>& directions = sc_data->getDirectionVector();
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            if (!directions(axis)) continue;
+            arrays.push_back(&sc_data->getArrayData(axis));
+            boxes.push_back(SideGeometry<NDIM>::toSideBox(patch_box, axis));
+        }
+        return;
+    }
+    Pointer<NodeData<NDIM, double> > nc_data = data;
+    if (nc_data)
+    {
+        arrays.push_back(&nc_data->getArrayData());
+        boxes.push_back(NodeGeometry<NDIM>::toNodeBox(patch_box));
+        return;
+    }
+    TBOX_ERROR("PETScSAMRAIVectorReal: unsupported patch data type" << std::endl);
+    return;
+} // get_interior_arrays
+
+// Offset of index i relative to the beginning of a single depth of an array.
+inline int
+array_offset(const ArrayData<NDIM, double>& array, const Index<NDIM>& i)
+{
+    const Box<NDIM>& array_box = array.getBox();
+    int offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - array_box.lower()(d)) * stride;
+        stride *= array_box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+
+// Compute the local parts of the dot products (x,y[k]), k = 0,...,nv-1, in a
+// single sweep over the interior data of x.  If patch_val is non-NULL, the
+// contribution of each patch to the kth dot product is also appended to
+// (*patch_val)[k].
+void
+fused_mdot_local(const SAMRAIVectorReal<NDIM, double>* const x,
+                 const int nv,
+                 const std::vector<const SAMRAIVectorReal<NDIM, double>*>& y,
+                 double* const val,
+                 std::vector<std::vector<double> >* const patch_val = NULL)
+{
+    std::fill(val, val + nv, 0.0);
+    if (nv == 0) return;
+    if (patch_val) patch_val->assign(nv, std::vector<double>());
+    std::vector<double> patch_sum(nv, 0.0);
+    double* const sum = (patch_val ? &patch_sum[0] : val);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x->getPatchHierarchy();
+    const int coarsest_ln = x->getCoarsestLevelNumber();
+    const int finest_ln = x->getFinestLevelNumber();
+    const int ncomp = x->getNumberOfComponents();
+    std::vector<ArrayData<NDIM, double>*> x_arrays, cvol_arrays;
+    std::vector<std::vector<ArrayData<NDIM, double>*> > y_arrays(nv);
+    std::vector<Box<NDIM> > boxes;
+    std::vector<const double*> y_rows(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const int x_idx = x->getComponentDescriptorIndex(comp);
+        const int cvol_idx = x->getControlVolumeIndex(comp);
+        const bool has_cvol = cvol_idx >= 0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (patch_val) std::fill(patch_sum.begin(), patch_sum.end(), 0.0);
+                for (int k = 0; k < nv; ++k)
+                {
+                    get_interior_arrays(patch->getPatchData(y[k]->getComponentDescriptorIndex(comp)),
+                                        patch_box,
+                                        y_arrays[k],
+                                        boxes);
+                }
+                if (has_cvol) get_interior_arrays(patch->getPatchData(cvol_idx), patch_box, cvol_arrays, boxes);
+                get_interior_arrays(patch->getPatchData(x_idx), patch_box, x_arrays, boxes);
+                for (unsigned int a = 0; a < x_arrays.size(); ++a)
+                {
+                    const Box<NDIM>& box = boxes[a];
+                    if (box.empty()) continue;
+                    Box<NDIM> row_box = box;
+                    row_box.upper()(0) = row_box.lower()(0);
+                    const int n0 = box.numberCells(0);
+                    const int depth = x_arrays[a]->getDepth();
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        for (Box<NDIM>::Iterator b(row_box); b; b++)
+                        {
+                            const Index<NDIM>& i = b();
+                            const double* const x_row = x_arrays[a]->getPointer(d) + array_offset(*x_arrays[a], i);
+                            for (int k = 0; k < nv; ++k)
+                            {
+                                y_rows[k] = y_arrays[k][a]->getPointer(d) + array_offset(*y_arrays[k][a], i);
+                            }
+                            if (has_cvol)
+                            {
+                                const int cvol_d = (cvol_arrays[a]->getDepth() == depth ? d : 0);
+                                const double* const w_row =
+                                    cvol_arrays[a]->getPointer(cvol_d) + array_offset(*cvol_arrays[a], i);
+                                for (int j = 0; j < n0; ++j)
+                                {
+                                    const double xw = x_row[j] * w_row[j];
+                                    for (int k = 0; k < nv; ++k)
+                                    {
+                                        sum[k] += xw * y_rows[k][j];
+                                    }
+                                }
+                            }
+                            else
+                            {
+                                for (int j = 0; j < n0; ++j)
+                                {
+                                    const double xw = x_row[j];
+                                    for (int k = 0; k < nv; ++k)
+                                    {
+                                        sum[k] += xw * y_rows[k][j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+                if (patch_val)
+                {
+                    for (int k = 0; k < nv; ++k)
+                    {
+                        val[k] += patch_sum[k];
+                        (*patch_val)[k].push_back(patch_sum[k]);
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_mdot_local
+
+// Compute the dot products (x,y[k]), k = 0,...,nv-1, by summing their
+// per-patch contributions reproducibly using a single global reduction.
+inline void
+reproducible_mdot(const SAMRAIVectorReal<NDIM, double>* const x,
+                  const int nv,
+                  const std::vector<const SAMRAIVectorReal<NDIM, double>*>& y,
+                  double* const val)
+{
+    std::vector<std::vector<double> > patch_val;
+    fused_mdot_local(x, nv, y, val, &patch_val);
+    NormOps::reproducibleSum(patch_val, val);
+    return;
+} // reproducible_mdot
+
+// Compute y := y + sum_k alpha[k] x[k] in a single sweep over the data
+// (including ghost values) of y.
+void
+fused_maxpy(SAMRAIVectorReal<NDIM, double>* const y,
+            const int nv,
+            const double* const alpha,
+            const std::vector<const SAMRAIVectorReal<NDIM, double>*>& x)
+{
+    if (nv == 0) return;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y->getPatchHierarchy();
+    const int coarsest_ln = y->getCoarsestLevelNumber();
+    const int finest_ln = y->getFinestLevelNumber();
+    const int ncomp = y->getNumberOfComponents();
+    std::vector<ArrayData<NDIM, double>*> y_arrays;
+    std::vector<std::vector<ArrayData<NDIM, double>*> > x_arrays(nv);
+    std::vector<Box<NDIM> > boxes;
+    std::vector<const double*> x_rows(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const int y_idx = y->getComponentDescriptorIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                for (int k = 0; k < nv; ++k)
+                {
+                    get_interior_arrays(patch->getPatchData(x[k]->getComponentDescriptorIndex(comp)),
+                                        patch_box,
+                                        x_arrays[k],
+                                        boxes);
+                }
+                get_interior_arrays(patch->getPatchData(y_idx), patch_box, y_arrays, boxes);
+                for (unsigned int a = 0; a < y_arrays.size(); ++a)
+                {
+                    // As in the unfused SAMRAI vector operations, update all
+                    // values of y (including ghost values) at which the data
+                    // of all of the vectors x[k] are defined.
+                    Box<NDIM> box = y_arrays[a]->getBox();
+                    for (int k = 0; k < nv; ++k)
+                    {
+                        box = box * x_arrays[k][a]->getBox();
+                    }
+                    if (box.empty()) continue;
+                    Box<NDIM> row_box = box;
+                    row_box.upper()(0) = row_box.lower()(0);
+                    const int n0 = box.numberCells(0);
+                    const int depth = y_arrays[a]->getDepth();
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        for (Box<NDIM>::Iterator b(row_box); b; b++)
+                        {
+                            const Index<NDIM>& i = b();
+                            double* const y_row = y_arrays[a]->getPointer(d) + array_offset(*y_arrays[a], i);
+                            for (int k = 0; k < nv; ++k)
+                            {
+                                x_rows[k] = x_arrays[k][a]->getPointer(d) + array_offset(*x_arrays[k][a], i);
+                            }
+                            for (int j = 0; j < n0; ++j)
+                            {
+                                double sum = y_row[j];
+                                for (int k = 0; k < nv; ++k)
+                                {
+                                    sum += alpha[k] * x_rows[k][j];
+                                }
+                                y_row[j] = sum;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_maxpy
 }
 
+bool PETScSAMRAIVectorReal::s_use_reproducible_reductions = false;
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+void
+PETScSAMRAIVectorReal::setUseReproducibleReductions(const bool use_reproducible_reductions)
+{
+    s_use_reproducible_reductions = use_reproducible_reductions;
+    return;
+} // setUseReproducibleReductions
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > samrai_vector,
@@ -318,7 +612,15 @@ PETScSAMRAIVectorReal::VecDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_dot);
     PSVR_CHECK2(x, y);
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    if (s_use_reproducible_reductions && supports_fused_ops(PSVR_CAST2(x)))
+    {
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> y_vecs(1, PSVR_CAST2(y));
+        reproducible_mdot(PSVR_CAST2(x), 1, y_vecs, val);
+    }
+    else
+    {
+        *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    }
     IBTK_TIMER_STOP(t_vec_dot);
     PetscFunctionReturn(0);
 }
@@ -329,12 +631,32 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (supports_fused_ops(PSVR_CAST2(x)))
+    {
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> y_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            y_vecs[i] = PSVR_CAST2(y[i]);
+        }
+        if (s_use_reproducible_reductions)
+        {
+            reproducible_mdot(PSVR_CAST2(x), nv, y_vecs, val);
+        }
+        else
+        {
+            fused_mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
+            SAMRAI_MPI::sumReduction(val, nv);
+        }
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
+        SAMRAI_MPI::sumReduction(val, nv);
     }
-    SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
     PetscFunctionReturn(0);
 }
@@ -356,6 +678,11 @@ PETScSAMRAIVectorReal::VecNorm_SAMRAI(Vec x, NormType type, PetscScalar* val)
     {
         *val = NormOps::maxNorm(PSVR_CAST2(x));
     }
+    else if (type == NORM_1_AND_2 && s_use_reproducible_reductions)
+    {
+        val[0] = NormOps::L1Norm(PSVR_CAST2(x));
+        val[1] = NormOps::L2Norm(PSVR_CAST2(x));
+    }
     else if (type == NORM_1_AND_2)
     {
         static const bool local_only = true;
@@ -382,7 +709,15 @@ PETScSAMRAIVectorReal::VecTDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_t_dot);
     PSVR_CHECK2(x, y);
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    if (s_use_reproducible_reductions && supports_fused_ops(PSVR_CAST2(x)))
+    {
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> y_vecs(1, PSVR_CAST2(y));
+        reproducible_mdot(PSVR_CAST2(x), 1, y_vecs, val);
+    }
+    else
+    {
+        *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    }
     IBTK_TIMER_STOP(t_vec_t_dot);
     PetscFunctionReturn(0);
 }
@@ -393,12 +728,32 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (supports_fused_ops(PSVR_CAST2(x)))
+    {
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> y_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            y_vecs[i] = PSVR_CAST2(y[i]);
+        }
+        if (s_use_reproducible_reductions)
+        {
+            reproducible_mdot(PSVR_CAST2(x), nv, y_vecs, val);
+        }
+        else
+        {
+            fused_mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
+            SAMRAI_MPI::sumReduction(val, nv);
+        }
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
+        SAMRAI_MPI::sumReduction(val, nv);
     }
-    SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
     PetscFunctionReturn(0);
 }
@@ -515,20 +870,32 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     IBTK_TIMER_START(t_vec_maxpy);
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
-    static const bool interior_only = false;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (supports_fused_ops(PSVR_CAST2(y)))
     {
-        if (MathUtilities<double>::equalEps(alpha[i], 1.0))
-        {
-            PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
-        }
-        else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> x_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i)
         {
-            PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
+            x_vecs[i] = PSVR_CAST2(x[i]);
         }
-        else
+        fused_maxpy(PSVR_CAST2(y), nv, alpha, x_vecs);
+    }
+    else
+    {
+        static const bool interior_only = false;
+        for (PetscInt i = 0; i < nv; ++i)
         {
-            PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            if (MathUtilities<double>::equalEps(alpha[i], 1.0))
+            {
+                PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
+            else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
+            {
+                PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
+            }
+            else
+            {
+                PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
         }
     }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
@@ -746,10 +1113,22 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (supports_fused_ops(PSVR_CAST2(x)))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> y_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            y_vecs[i] = PSVR_CAST2(y[i]);
+        }
+        fused_mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
@@ -761,10 +1140,22 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (supports_fused_ops(PSVR_CAST2(x)))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> y_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            y_vecs[i] = PSVR_CAST2(y[i]);
+        }
+        fused_mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
@@ -785,8 +1176,31 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    double vals[2];
+    if (supports_fused_ops(PSVR_CAST2(t)))
+    {
+        std::vector<const SAMRAIVectorReal<NDIM, double>*> vecs(2);
+        vecs[0] = PSVR_CAST2(s);
+        vecs[1] = PSVR_CAST2(t);
+        if (s_use_reproducible_reductions)
+        {
+            reproducible_mdot(PSVR_CAST2(t), 2, vecs, vals);
+        }
+        else
+        {
+            fused_mdot_local(PSVR_CAST2(t), 2, vecs, vals);
+            SAMRAI_MPI::sumReduction(vals, 2);
+        }
+    }
+    else
+    {
+        static const bool local_only = true;
+        vals[0] = PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only);
+        vals[1] = PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only);
+        SAMRAI_MPI::sumReduction(vals, 2);
+    }
+    *dp = vals[0];
+    *nm = vals[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
@@ -103,6 +103,15 @@ CartGridFunction::setDataOnPatchLevel(const int data_idx,
     return;
 } // setDataOnPatchLevel
 
+void
+CartGridFunction::resetHierarchyConfiguration(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                              const int /*coarsest_ln*/,
+                                              const int /*finest_ln*/)
+{
+    // intentionally blank
+    return;
+} // resetHierarchyConfiguration
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -342,6 +342,18 @@ CartGridFunctionSet::setDataOnPatch(int data_idx,
     return;
 } // setDataOnPatch
 
+void
+CartGridFunctionSet::resetHierarchyConfiguration(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                 const int coarsest_ln,
+                                                 const int finest_ln)
+{
+    for (unsigned int k = 0; k < d_fcns.size(); ++k)
+    {
+        d_fcns[k]->resetHierarchyConfiguration(hierarchy, coarsest_ln, finest_ln);
+    }
+    return;
+} // resetHierarchyConfiguration
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
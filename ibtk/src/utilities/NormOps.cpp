@@ -35,8 +35,8 @@
 #include <math.h>
 #include <stddef.h>
 #include <algorithm>
-#include <functional>
-#include <numeric>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 #include "CellData.h"
@@ -75,23 +75,152 @@ namespace IBTK
 
 namespace
 {
-// WARNING: This function will sort the input vector in ascending order.
-inline double
-accurate_sum(std::vector<double>& vec)
+// Reproducible sums are accumulated exactly in a fixed-point representation
+// whose "digits" are stored as doubles.  Each digit carries DIGIT_BITS bits, and
+// the digits together span the full range of (possibly subnormal) finite
+// doubles.  The leading digit is signed; all other digits are kept in
+// [0,DIGIT_BASE) by normalization.  Separate slots count NaN and infinite
+// summands so that these propagate as in floating-point arithmetic.
+static const int DIGIT_BITS = 32;
+static const double DIGIT_BASE = 4294967296.0; // 2^32
+static const int MANTISSA_BITS = std::numeric_limits<double>::digits;
+static const int EXPONENT_OFFSET = 1126; // 2^(-EXPONENT_OFFSET) is the weight of the lowest bit of digit 0
+static const int SUBNORMAL_LSB = EXPONENT_OFFSET + std::numeric_limits<double>::min_exponent - MANTISSA_BITS;
+static const int NUM_DIGITS = 72;
+static const int NAN_SLOT = NUM_DIGITS;
+static const int POS_INF_SLOT = NUM_DIGITS + 1;
+static const int NEG_INF_SLOT = NUM_DIGITS + 2;
+static const int ACCUMULATOR_SIZE = NUM_DIGITS + 3;
+
+// Each unnormalized addition changes a digit by less than DIGIT_BASE, so the
+// digits remain exactly representable for at least this many additions.
+static const int MAX_UNNORMALIZED_ADDITIONS = 1 << 20;
+
+// Propagate carries so that all but the leading digit lie in [0,DIGIT_BASE).
+inline void
+normalize_accumulator(double* const acc)
+{
+    for (int k = 0; k < NUM_DIGITS - 1; ++k)
+    {
+        const double carry = std::floor(acc[k] / DIGIT_BASE);
+        acc[k] -= carry * DIGIT_BASE;
+        acc[k + 1] += carry;
+    }
+    return;
+} // normalize_accumulator
+
+// Exactly add x to the accumulator.
+inline void
+add_to_accumulator(double* const acc, const double x)
 {
-    if (vec.size() == 1) return vec[0];
-    std::sort(vec.begin(), vec.end(), std::less<double>());
-    return std::accumulate(vec.begin(), vec.end(), 0.0);
-} // accurate_sum
+    if (x == 0.0) return;
+    if (x != x)
+    {
+        acc[NAN_SLOT] += 1.0;
+        return;
+    }
+    if (std::abs(x) > std::numeric_limits<double>::max())
+    {
+        acc[x > 0.0 ? POS_INF_SLOT : NEG_INF_SLOT] += 1.0;
+        return;
+    }
+
+    // Write |x| = m 2^(e-p), with m an integer of at most p bits, and split m
+    // 2^((e-p+offset) mod DIGIT_BITS) into three digit-sized pieces.
+    int e;
+    const double f = std::frexp(std::abs(x), &e);
+    const double m = std::ldexp(f, MANTISSA_BITS);
+    const int shift = e - MANTISSA_BITS + EXPONENT_OFFSET;
+    const int k = shift / DIGIT_BITS;
+    double v = std::ldexp(m, shift % DIGIT_BITS);
+    const double hi = std::floor(std::ldexp(v, -2 * DIGIT_BITS));
+    v -= std::ldexp(hi, 2 * DIGIT_BITS);
+    const double mid = std::floor(std::ldexp(v, -DIGIT_BITS));
+    const double lo = v - std::ldexp(mid, DIGIT_BITS);
+    const double sgn = (x > 0.0 ? 1.0 : -1.0);
+    acc[k] += sgn * lo;
+    acc[k + 1] += sgn * mid;
+    acc[k + 2] += sgn * hi;
+    return;
+} // add_to_accumulator
 
-// WARNING: This function will sort the input vector in ascending order.
+// Accumulate the values exactly.  The result is normalized.
+inline void
+accumulate(double* const acc, const std::vector<double>& vals)
+{
+    std::fill(acc, acc + ACCUMULATOR_SIZE, 0.0);
+    int num_unnormalized = 0;
+    for (std::vector<double>::const_iterator it = vals.begin(); it != vals.end(); ++it)
+    {
+        add_to_accumulator(acc, *it);
+        if (++num_unnormalized == MAX_UNNORMALIZED_ADDITIONS)
+        {
+            normalize_accumulator(acc);
+            num_unnormalized = 0;
+        }
+    }
+    normalize_accumulator(acc);
+    return;
+} // accumulate
+
+// Return the bit at position pos of a normalized, nonnegative accumulator.
+inline bool
+accumulator_bit(const double* const acc, const int pos)
+{
+    const unsigned int digit = static_cast<unsigned int>(acc[pos / DIGIT_BITS]);
+    return ((digit >> (pos % DIGIT_BITS)) & 1U) != 0U;
+} // accumulator_bit
+
+// Round the exact value stored in the accumulator to the nearest double (ties
+// to even).  The result depends only upon the exact value, and not upon how it
+// was accumulated.
 inline double
-accurate_sum_of_squares(std::vector<double>& vec)
+accumulator_value(double* const acc)
 {
-    if (vec.size() == 1) return vec[0] * vec[0];
-    std::sort(vec.begin(), vec.end(), std::less<double>());
-    return std::inner_product(vec.begin(), vec.end(), vec.begin(), 0.0);
-} // accurate_sum_of_squares
+    const bool has_nan = acc[NAN_SLOT] > 0.0;
+    const bool has_pos_inf = acc[POS_INF_SLOT] > 0.0;
+    const bool has_neg_inf = acc[NEG_INF_SLOT] > 0.0;
+    if (has_nan || (has_pos_inf && has_neg_inf)) return std::numeric_limits<double>::quiet_NaN();
+    if (has_pos_inf) return std::numeric_limits<double>::infinity();
+    if (has_neg_inf) return -std::numeric_limits<double>::infinity();
+
+    normalize_accumulator(acc);
+    double sgn = 1.0;
+    if (acc[NUM_DIGITS - 1] < 0.0)
+    {
+        sgn = -1.0;
+        for (int k = 0; k < NUM_DIGITS; ++k) acc[k] = -acc[k];
+        normalize_accumulator(acc);
+    }
+
+    // Locate the most significant nonzero bit.
+    int k_max = NUM_DIGITS - 1;
+    while (k_max >= 0 && acc[k_max] == 0.0) --k_max;
+    if (k_max < 0) return 0.0;
+    int msb = (k_max + 1) * DIGIT_BITS - 1;
+    while (!accumulator_bit(acc, msb)) --msb;
+
+    // Keep at most MANTISSA_BITS bits, none of which may be of lower weight
+    // than the lowest bit of a subnormal, and round once.  Because every
+    // summand is a multiple of the smallest subnormal, so is the sum, and no
+    // rounding is required when lsb == SUBNORMAL_LSB.
+    const int lsb = std::max(msb - MANTISSA_BITS + 1, SUBNORMAL_LSB);
+    double m = 0.0;
+    for (int pos = msb; pos >= lsb; --pos)
+    {
+        m = 2.0 * m + (accumulator_bit(acc, pos) ? 1.0 : 0.0);
+    }
+    if (lsb > SUBNORMAL_LSB && accumulator_bit(acc, lsb - 1))
+    {
+        bool sticky = false;
+        for (int pos = lsb - 2; pos >= 0 && !sticky; --pos)
+        {
+            sticky = accumulator_bit(acc, pos);
+        }
+        if (sticky || std::fmod(m, 2.0) != 0.0) m += 1.0;
+    }
+    return sgn * std::ldexp(m, lsb - EXPONENT_OFFSET);
+} // accumulator_value
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -99,27 +228,17 @@ accurate_sum_of_squares(std::vector<double>& vec)
 double
 NormOps::L1Norm(const SAMRAIVectorReal<NDIM, double>* const samrai_vector, const bool local_only)
 {
-    const double L1_norm_local = L1Norm_local(samrai_vector);
-    if (local_only) return L1_norm_local;
-
-    const int nprocs = SAMRAI_MPI::getNodes();
-    std::vector<double> L1_norm_proc(nprocs, 0.0);
-    SAMRAI_MPI::allGather(L1_norm_local, &L1_norm_proc[0]);
-    const double ret_val = accurate_sum(L1_norm_proc);
-    return ret_val;
+    std::vector<double> L1_norm_patch;
+    getL1NormPatchContributions(samrai_vector, L1_norm_patch);
+    return reproducibleSum(L1_norm_patch, local_only);
 } // L1Norm
 
 double
 NormOps::L2Norm(const SAMRAIVectorReal<NDIM, double>* const samrai_vector, const bool local_only)
 {
-    const double L2_norm_local = L2Norm_local(samrai_vector);
-    if (local_only) return L2_norm_local;
-
-    const int nprocs = SAMRAI_MPI::getNodes();
-    std::vector<double> L2_norm_proc(nprocs, 0.0);
-    SAMRAI_MPI::allGather(L2_norm_local, &L2_norm_proc[0]);
-    const double ret_val = std::sqrt(accurate_sum_of_squares(L2_norm_proc));
-    return ret_val;
+    std::vector<double> L2_norm_squared_patch;
+    getL2NormSquaredPatchContributions(samrai_vector, L2_norm_squared_patch);
+    return std::sqrt(reproducibleSum(L2_norm_squared_patch, local_only));
 } // L2Norm
 
 double
@@ -128,14 +247,45 @@ NormOps::maxNorm(const SAMRAIVectorReal<NDIM, double>* const samrai_vector, cons
     return samrai_vector->maxNorm(local_only);
 } // maxNorm
 
+double
+NormOps::reproducibleSum(const std::vector<double>& local_vals, const bool local_only)
+{
+    double sum;
+    reproducibleSum(std::vector<std::vector<double> >(1, local_vals), &sum, local_only);
+    return sum;
+} // reproducibleSum
+
+void
+NormOps::reproducibleSum(const std::vector<std::vector<double> >& local_vals, double* const sums, const bool local_only)
+{
+    const int n = static_cast<int>(local_vals.size());
+    if (n == 0) return;
+    std::vector<double> acc(n * ACCUMULATOR_SIZE);
+    for (int i = 0; i < n; ++i)
+    {
+        accumulate(&acc[i * ACCUMULATOR_SIZE], local_vals[i]);
+    }
+
+    // Since the digits are normalized, their sum over all processes is exact
+    // (for fewer than 2^21 processes) and hence independent of the order in
+    // which MPI performs the reduction.
+    if (!local_only) SAMRAI_MPI::sumReduction(&acc[0], n * ACCUMULATOR_SIZE);
+    for (int i = 0; i < n; ++i)
+    {
+        sums[i] = accumulator_value(&acc[i * ACCUMULATOR_SIZE]);
+    }
+    return;
+} // reproducibleSum
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-double
-NormOps::L1Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
+void
+NormOps::getL1NormPatchContributions(const SAMRAIVectorReal<NDIM, double>* const samrai_vector,
+                                     std::vector<double>& L1_norm_patch)
 {
-    std::vector<double> L1_norm_local_patch;
+    L1_norm_patch.clear();
     Pointer<PatchHierarchy<NDIM> > hierarchy = samrai_vector->getPatchHierarchy();
     const int coarsest_ln = samrai_vector->getCoarsestLevelNumber();
     const int finest_ln = samrai_vector->getFinestLevelNumber();
@@ -161,7 +311,7 @@ NormOps::L1Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
                     Pointer<CellData<NDIM, double> > comp_data = patch->getPatchData(comp_idx);
                     Pointer<CellData<NDIM, double> > cvol_data =
                         (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(NULL));
-                    L1_norm_local_patch.push_back(patch_ops.L1Norm(comp_data, patch_box, cvol_data));
+                    L1_norm_patch.push_back(patch_ops.L1Norm(comp_data, patch_box, cvol_data));
                 }
             }
         }
@@ -180,18 +330,19 @@ NormOps::L1Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
                     Pointer<SideData<NDIM, double> > comp_data = patch->getPatchData(comp_idx);
                     Pointer<SideData<NDIM, double> > cvol_data =
                         (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(NULL));
-                    L1_norm_local_patch.push_back(patch_ops.L1Norm(comp_data, patch_box, cvol_data));
+                    L1_norm_patch.push_back(patch_ops.L1Norm(comp_data, patch_box, cvol_data));
                 }
             }
         }
     }
-    return accurate_sum(L1_norm_local_patch);
-} // L1Norm_local
+    return;
+} // getL1NormPatchContributions
 
-double
-NormOps::L2Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
+void
+NormOps::getL2NormSquaredPatchContributions(const SAMRAIVectorReal<NDIM, double>* const samrai_vector,
+                                            std::vector<double>& L2_norm_squared_patch)
 {
-    std::vector<double> L2_norm_local_patch;
+    L2_norm_squared_patch.clear();
     Pointer<PatchHierarchy<NDIM> > hierarchy = samrai_vector->getPatchHierarchy();
     const int coarsest_ln = samrai_vector->getCoarsestLevelNumber();
     const int finest_ln = samrai_vector->getFinestLevelNumber();
@@ -217,7 +368,7 @@ NormOps::L2Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
                     Pointer<CellData<NDIM, double> > comp_data = patch->getPatchData(comp_idx);
                     Pointer<CellData<NDIM, double> > cvol_data =
                         (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(NULL));
-                    L2_norm_local_patch.push_back(patch_ops.L2Norm(comp_data, patch_box, cvol_data));
+                    L2_norm_squared_patch.push_back(patch_ops.dot(comp_data, comp_data, patch_box, cvol_data));
                 }
             }
         }
@@ -236,13 +387,13 @@ NormOps::L2Norm_local(const SAMRAIVectorReal<NDIM, double>* const samrai_vector)
                     Pointer<SideData<NDIM, double> > comp_data = patch->getPatchData(comp_idx);
                     Pointer<SideData<NDIM, double> > cvol_data =
                         (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(NULL));
-                    L2_norm_local_patch.push_back(patch_ops.L2Norm(comp_data, patch_box, cvol_data));
+                    L2_norm_squared_patch.push_back(patch_ops.dot(comp_data, comp_data, patch_box, cvol_data));
                 }
             }
         }
     }
-    return std::sqrt(accurate_sum_of_squares(L2_norm_local_patch));
-} // L2Norm_local
+    return;
+} // getL2NormSquaredPatchContributions
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -54,6 +54,7 @@
 #include "NodeIterator.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchHierarchy.h"
 #include "SideData.h"
 #include "SideIndex.h"
 #include "SideIterator.h"
@@ -92,6 +93,12 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Maximum number of function values retained for time-independent functions.
+static const size_t MAX_CACHED_VALUES = 8 * 1024 * 1024;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 muParserCartGridFunction::muParserCartGridFunction(const std::string& object_name,
@@ -102,8 +109,15 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
       d_constants(),
       d_function_strings(),
       d_parsers(),
-      d_parser_time(),
-      d_parser_posn()
+      d_bulk_time(1, 0.0),
+      d_bulk_posn(),
+      d_bulk_values(),
+      d_bound_time(NULL),
+      d_bound_posn(),
+      d_time_dependent(true),
+      d_cache_time_independent_values(false),
+      d_value_cache(),
+      d_value_cache_size(0)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -127,6 +141,10 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
             d_constants[name] = input_db->getInteger(name);
         }
     }
+    if (input_db->isBool("cache_time_independent_values"))
+    {
+        d_cache_time_independent_values = input_db->getBool("cache_time_independent_values");
+    }
 
     // Initialize the parser(s) with data read in from the input database.
     if (input_db->isString("function"))
@@ -275,19 +293,28 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         {
             it->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        it->DefineVar("T", &d_parser_time);
-        it->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_bulk_posn[d].resize(1, 0.0);
+        d_bound_posn[d] = NULL;
+    }
+    bindParserVariables();
+
+    // Determine whether any of the functions depend on time.
+    d_time_dependent = false;
+    for (std::vector<mu::Parser>::const_iterator cit = d_parsers.begin(); cit != d_parsers.end(); ++cit)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            it->DefineVar("X" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = cit->GetUsedVar();
+            if (used_vars.count("t") || used_vars.count("T")) d_time_dependent = true;
+        }
+        catch (...)
+        {
+            d_time_dependent = true;
         }
     }
     return;
@@ -313,14 +340,7 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
-    const Index<NDIM>& patch_lower = patch_box.lower();
-    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-
-    const double* const XLower = pgeom->getXLower();
-    const double* const dx = pgeom->getDx();
 
     // Set the data in the patch.
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
@@ -339,32 +359,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            const std::vector<double>& values =
+                evaluateFunction(function_depth, CELL_CENTERING, 0, *patch, data_time);
+            int k = 0;
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*cc_data)(ic(), data_depth) = values[k];
             }
         }
     }
@@ -398,42 +398,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                 {
                     function_depth = NDIM * data_depth + axis;
                 }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const std::vector<double>& values =
+                    evaluateFunction(function_depth, FACE_CENTERING, axis, *patch, data_time);
+                int k = 0;
+                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    (*fc_data)(ic(), data_depth) = values[k];
                 }
             }
         }
@@ -446,32 +416,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            const std::vector<double>& values =
+                evaluateFunction(function_depth, NODE_CENTERING, 0, *patch, data_time);
+            int k = 0;
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*nc_data)(ic(), data_depth) = values[k];
             }
         }
     }
@@ -505,40 +455,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                 {
                     function_depth = NDIM * data_depth + axis;
                 }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const std::vector<double>& values =
+                    evaluateFunction(function_depth, SIDE_CENTERING, axis, *patch, data_time);
+                int k = 0;
+                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    (*sc_data)(ic(), data_depth) = values[k];
                 }
             }
         }
@@ -552,6 +474,212 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
+void
+muParserCartGridFunction::resetHierarchyConfiguration(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                      const int coarsest_ln,
+                                                      const int /*finest_ln*/)
+{
+    // NOTE: Levels finer than finest_ln may have been removed from the
+    // hierarchy, so the values cached for all levels at or above coarsest_ln
+    // are discarded.
+    std::map<ValueCacheKey, std::vector<double> >::iterator it = d_value_cache.begin();
+    while (it != d_value_cache.end())
+    {
+        if (it->first.level_number >= coarsest_ln)
+        {
+            d_value_cache_size -= it->second.size();
+            d_value_cache.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return;
+} // resetHierarchyConfiguration
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+bool
+muParserCartGridFunction::ValueCacheKey::operator<(const ValueCacheKey& that) const
+{
+    if (level_number != that.level_number) return level_number < that.level_number;
+    if (function_depth != that.function_depth) return function_depth < that.function_depth;
+    if (centering != that.centering) return centering < that.centering;
+    if (axis != that.axis) return axis < that.axis;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (patch_box.lower(d) != that.patch_box.lower(d)) return patch_box.lower(d) < that.patch_box.lower(d);
+        if (patch_box.upper(d) != that.patch_box.upper(d)) return patch_box.upper(d) < that.patch_box.upper(d);
+        if (x_lower[d] != that.x_lower[d]) return x_lower[d] < that.x_lower[d];
+        if (dx[d] != that.dx[d]) return dx[d] < that.dx[d];
+    }
+    return false;
+} // operator<
+
+void
+muParserCartGridFunction::bindParserVariables()
+{
+    bool rebind = d_bound_time != &d_bulk_time[0];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        rebind = rebind || d_bound_posn[d] != &d_bulk_posn[d][0];
+    }
+    if (!rebind) return;
+
+    // NOTE: In bulk mode, mu::Parser reads the value of each variable at an
+    // offset from the address provided to DefineVar(), so the variables are
+    // bound to the first entries of the bulk evaluation buffers.
+    d_bound_time = &d_bulk_time[0];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_bound_posn[d] = &d_bulk_posn[d][0];
+    }
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        it->DefineVar("T", d_bound_time);
+        it->DefineVar("t", d_bound_time);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            std::ostringstream stream;
+            stream << d;
+            const std::string postfix = stream.str();
+            it->DefineVar("X" + postfix, d_bound_posn[d]);
+            it->DefineVar("x" + postfix, d_bound_posn[d]);
+            it->DefineVar("X_" + postfix, d_bound_posn[d]);
+            it->DefineVar("x_" + postfix, d_bound_posn[d]);
+        }
+    }
+    return;
+} // bindParserVariables
+
+const std::vector<double>&
+muParserCartGridFunction::evaluateFunction(const int function_depth,
+                                           const DataCentering centering,
+                                           const unsigned int axis,
+                                           const Patch<NDIM>& patch,
+                                           const double data_time)
+{
+    const Box<NDIM>& patch_box = patch.getBox();
+    const Index<NDIM>& patch_lower = patch_box.lower();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+
+    const double* const XLower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+
+    // Values of time-independent functions are reused once they have been
+    // computed for a given patch configuration.
+    const bool use_cache = d_cache_time_independent_values && !d_time_dependent;
+    ValueCacheKey key;
+    if (use_cache)
+    {
+        key.level_number = patch.getPatchLevelNumber();
+        key.function_depth = function_depth;
+        key.centering = centering;
+        key.axis = axis;
+        key.patch_box = patch_box;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            key.x_lower[d] = XLower[d];
+            key.dx[d] = dx[d];
+        }
+        std::map<ValueCacheKey, std::vector<double> >::const_iterator it = d_value_cache.find(key);
+        if (it != d_value_cache.end()) return it->second;
+    }
+
+    // Determine the locations at which the function is to be evaluated.  The
+    // ordering of the locations is the same as that of the corresponding SAMRAI
+    // patch data iterators.
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_bulk_posn[d].clear();
+    }
+    switch (centering)
+    {
+    case CELL_CENTERING:
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+        {
+            const CellIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_bulk_posn[d].push_back(XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5));
+            }
+        }
+        break;
+    case FACE_CENTERING:
+        for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+        {
+            const FaceIndex<NDIM>& i = ic();
+            const Index<NDIM>& cell_idx = i.toCell(1);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_bulk_posn[d].push_back(XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) +
+                                                              (d == axis ? 0.0 : 0.5)));
+            }
+        }
+        break;
+    case NODE_CENTERING:
+        for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+        {
+            const NodeIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_bulk_posn[d].push_back(XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d))));
+            }
+        }
+        break;
+    case SIDE_CENTERING:
+        for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+        {
+            const SideIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_bulk_posn[d].push_back(XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) +
+                                                              (d == axis ? 0.0 : 0.5)));
+            }
+        }
+        break;
+    default:
+        TBOX_ERROR("muParserCartGridFunction::evaluateFunction():\n"
+                   << "  unsupported data centering.\n");
+    }
+    const int n_values = static_cast<int>(d_bulk_posn[0].size());
+    d_bulk_values.resize(n_values);
+    if (n_values == 0) return d_bulk_values;
+
+    // Evaluate the function at all locations in bulk mode.
+    d_bulk_time.assign(n_values, data_time);
+    bindParserVariables();
+    try
+    {
+        d_parsers[function_depth].Eval(&d_bulk_values[0], n_values);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+
+    if (use_cache && d_value_cache_size + n_values <= MAX_CACHED_VALUES)
+    {
+        d_value_cache_size += n_values;
+        std::vector<double>& cached_values = d_value_cache[key];
+        cached_values = d_bulk_values;
+        return cached_values;
+    }
+    return d_bulk_values;
+} // evaluateFunction
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -38,6 +38,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "HierarchyFaceDataOpsReal.h"
 #include "IntVector.h"
@@ -52,6 +53,11 @@ namespace IBAMR
 {
 class ConvectiveOperator;
 } // namespace IBAMR
+namespace IBTK
+{
+class LaplaceOperator;
+class PoissonSolver;
+} // namespace IBTK
 namespace SAMRAI
 {
 namespace hier
@@ -71,6 +77,14 @@ namespace pdat
 template <int DIM, class TYPE>
 class CellVariable;
 } // namespace pdat
+namespace solv
+{
+class PoissonSpecifications;
+template <int DIM>
+class RobinBcCoefStrategy;
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -94,6 +108,30 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * When the input database sets <tt>group_helmholtz_solves = TRUE</tt>,
+ * transported quantities that have identical constant diffusion and damping
+ * coefficients, diffusion time stepping types, and physical boundary condition
+ * objects are advanced using a single multi-depth Helmholtz solve per cycle,
+ * rather than one solve per quantity.  The grouped quantities then share ghost
+ * cell fills and FAC cycles.  Quantities that use distinct boundary condition
+ * objects may be grouped explicitly via the <tt>helmholtz_solve_groups</tt>
+ * database, in which each entry is an array of the names of the transported
+ * quantities to be grouped, e.g.:
+ *
+ * \verbatim
+ helmholtz_solve_groups {
+    species = "C_0", "C_1", "C_2"
+ }
+ \endverbatim
+ *
+ * Each quantity in an explicit group keeps its own boundary conditions, but the
+ * diffusion and damping coefficients and diffusion time stepping types of the
+ * grouped quantities must agree.  Groups are determined when the integrator is
+ * initialized, and the grouped solvers are allocated using the integrator's
+ * default Helmholtz solver settings.  Quantities for which a Helmholtz solver
+ * has been provided via setHelmholtzSolver() (or obtained via
+ * getHelmholtzSolver()) before initialization are never grouped.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
@@ -355,6 +393,29 @@ protected:
              SAMRAI::tbox::Pointer<ConvectiveOperator> > d_Q_convective_op;
     std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> >, bool> d_Q_convective_op_needs_init;
 
+    /*!
+     * Grouped Helmholtz solves.
+     *
+     * d_Q_helmholtz_group maps the index of each transported quantity to its
+     * group number (or -1 if the quantity is solved separately), and
+     * d_helmholtz_groups lists the transported quantity indices in each group.
+     * Each group is solved using multi-depth scratch variables whose depths
+     * are the concatenated depths of the grouped quantities.
+     */
+    bool d_group_helmholtz_solves;
+    std::vector<std::vector<std::string> > d_helmholtz_solve_group_names;
+    std::vector<bool> d_Q_has_custom_helmholtz_solver;
+    std::vector<int> d_Q_helmholtz_group;
+    std::vector<std::vector<unsigned int> > d_helmholtz_groups;
+    std::vector<bool> d_helmholtz_group_is_explicit;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > > d_group_sol_var, d_group_rhs_var;
+    std::vector<std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> > d_group_bc_coefs;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_group_sol_vecs,
+        d_group_rhs_vecs;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_group_helmholtz_solvers;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LaplaceOperator> > d_group_helmholtz_rhs_ops;
+    std::vector<bool> d_group_helmholtz_solvers_need_init, d_group_helmholtz_rhs_ops_need_init;
+
 private:
     /*!
      * \brief Default constructor.
@@ -394,6 +455,44 @@ private:
      * by the object_name specified in the class constructor.
      */
     void getFromRestart();
+
+    /*!
+     * Determine whether two transported quantities may be advanced using a
+     * single multi-depth Helmholtz solve.  Unless require_identical_bc_coefs is
+     * false, the two quantities must also use the same boundary condition
+     * objects.
+     */
+    bool canGroupHelmholtzSolves(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q1_var,
+                                 SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q2_var,
+                                 bool require_identical_bc_coefs = true) const;
+
+    /*!
+     * Group the transported quantities and allocate the variables, operators,
+     * and solvers used for the grouped Helmholtz solves.
+     */
+    void setupHelmholtzGroups();
+
+    /*!
+     * Set the problem coefficients for the Helmholtz solver and right-hand
+     * side operator associated with the specified transported quantity.
+     */
+    void setHelmholtzSpecifications(SAMRAI::solv::PoissonSpecifications& solver_spec,
+                                    SAMRAI::solv::PoissonSpecifications& rhs_op_spec,
+                                    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q_var,
+                                    double dt);
+
+    /*!
+     * Copy data between the members of a group (in group order) and the
+     * corresponding depths of a multi-depth group variable.
+     */
+    void copyGroupData(int group_data_idx, const std::vector<int>& member_data_idxs, bool to_group);
+
+    /*!
+     * Remove the convective and forcing terms from the right-hand side of the
+     * Helmholtz problem for the specified transported quantity.
+     */
+    void resetHelmholtzRHS(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q_var,
+                           TimeSteppingType convective_time_stepping_type);
 };
 } // namespace IBAMR
 
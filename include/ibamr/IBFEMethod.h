@@ -51,6 +51,7 @@
 #include "libmesh/enum_fe_family.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/id_types.h"
 #include "tbox/Pointer.h"
 
 namespace IBTK
@@ -186,8 +187,33 @@ public:
      */
     typedef IBTK::TensorMeshFcnPtr PK1StressFcnPtr;
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function,
+     * which evaluates the stress at all n_qp quadrature points of an element in
+     * a single call.  The deformation gradients FF and the stresses PP are
+     * stored as n_qp consecutive row-major NDIM x NDIM blocks, and the physical
+     * and reference coordinates X and s are stored as n_qp consecutive NDIM
+     * vectors.
+     *
+     * \note When IBAMR is configured with <code>--enable-openmp</code>, batched
+     * functions are evaluated concurrently for different elements, and so they
+     * must be thread safe.  This requirement does not apply to builds without
+     * OpenMP support (the default), in which they are evaluated serially.
+     */
+    typedef void (*PK1StressBatchFcnPtr)(double* PP,
+                                         const double* FF,
+                                         const double* X,
+                                         const double* s,
+                                         unsigned int n_qp,
+                                         libMesh::Elem* elem,
+                                         const std::vector<libMesh::NumericVector<double>*>& system_data,
+                                         double data_time,
+                                         void* ctx);
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * \note At most one of fcn and batch_fcn should be non-NULL.
      */
     struct PK1StressFcnData
     {
@@ -196,11 +222,12 @@ public:
                          void* ctx = NULL,
                          libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
                          libMesh::Order quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+            : fcn(fcn), batch_fcn(NULL), systems(systems), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
         {
         }
 
         PK1StressFcnPtr fcn;
+        PK1StressBatchFcnPtr batch_fcn;
         std::vector<unsigned int> systems;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -234,6 +261,21 @@ public:
      */
     void registerPK1StressFunction(const PK1StressFcnData& data, unsigned int part = 0);
 
+    /*!
+     * Register a (optional) batched function to compute the first
+     * Piola-Kirchhoff stress tensor.  Batched functions receive all of the
+     * quadrature points of an element as contiguous arrays, which allows
+     * constitutive models to be vectorized.
+     *
+     * \see PK1StressBatchFcnPtr
+     */
+    void registerPK1StressBatchFunction(PK1StressBatchFcnPtr fcn,
+                                        const std::vector<unsigned int>& systems = std::vector<unsigned int>(),
+                                        void* ctx = NULL,
+                                        libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE,
+                                        libMesh::Order quad_order = libMesh::INVALID_ORDER,
+                                        unsigned int part = 0);
+
     /*!
      * Typedef specifying interface for Lagrangian body force distribution
      * function.
@@ -574,6 +616,11 @@ protected:
      */
     void updateCoordinateMapping(unsigned int part);
 
+    /*!
+     * \brief Discard all cached reference-configuration shape function data.
+     */
+    void clearReferenceShapeData();
+
     /*
      * Indicates whether the integrator should output logging messages.
      */
@@ -620,6 +667,8 @@ protected:
     libMesh::QuadratureType d_quad_type;
     libMesh::Order d_quad_order;
     bool d_use_consistent_mass_matrix;
+    double d_element_mapping_displacement_threshold;
+    std::string d_L2_projection_solver_type;
 
     /*
      * Functions used to compute the initial coordinates of the Lagrangian mesh.
@@ -631,6 +680,35 @@ protected:
      */
     std::vector<std::vector<PK1StressFcnData> > d_PK1_stress_fcn_data;
 
+    /*
+     * Reference-configuration shape functions, shape function gradients,
+     * quadrature weights, and quadrature points used to evaluate the volumetric
+     * PK1 stress integrals.  These data depend only on the undeformed mesh.
+     * When d_cache_reference_shape_data is true, they are cached for each part
+     * and each stress function so long as the total cache size does not exceed
+     * d_max_reference_shape_data_size (in megabytes).  Otherwise, they are
+     * recomputed whenever they are needed.  Cached data are keyed on the IDs of
+     * the local elements, and they are discarded whenever the data are
+     * redistributed.
+     */
+    struct ReferenceShapeData
+    {
+        ReferenceShapeData() : valid(false), disabled(false), num_bytes(0)
+        {
+        }
+
+        bool valid, disabled;
+        size_t num_bytes;
+        std::vector<libMesh::dof_id_type> elem_id;
+        std::vector<unsigned int> n_qp;
+        std::vector<size_t> qp_offset, phi_offset;
+        std::vector<double> phi, dphi, JxW, q_point;
+    };
+    std::vector<std::vector<ReferenceShapeData> > d_PK1_stress_ref_shape_data;
+    bool d_cache_reference_shape_data;
+    double d_max_reference_shape_data_size;
+    size_t d_reference_shape_data_size;
+
     /*
      * Functions used to compute additional body and surface forces on the
      * Lagrangian mesh.
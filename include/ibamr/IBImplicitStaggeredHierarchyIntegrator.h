@@ -38,6 +38,7 @@
 #include <string>
 
 #include "IntVector.h"
+#include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "ibamr/IBHierarchyIntegrator.h"
 #include "ibamr/IBImplicitStrategy.h"
@@ -87,6 +88,16 @@ namespace IBAMR
  * \brief Class IBImplicitStaggeredHierarchyIntegrator is an implementation of a
  * formally second-order accurate, nonlinearly-implicit version of the immersed
  * boundary method.
+ *
+ * When the structure position is retained as an unknown, setting the input
+ * option <code>use_sparse_LE_operators = TRUE</code> makes the linearized
+ * Jacobian, the preconditioner, and the Lagrangian Schur complement apply the
+ * Lagrangian-Eulerian coupling via sparse interpolation and spreading matrices
+ * that are rebuilt once per Newton iteration, rather than via
+ * IBTK::LDataManager::spread() and IBTK::LDataManager::interp().  These
+ * operators do not impose physical boundary conditions or treat coarse-fine
+ * interfaces, so this option requires a uniform grid on a domain that is
+ * periodic in all directions.
  */
 class IBImplicitStaggeredHierarchyIntegrator : public IBHierarchyIntegrator
 {
@@ -361,6 +372,18 @@ private:
      */
     PetscErrorCode lagrangianSchurApply(Vec x, Vec y);
 
+    /*!
+     * Spread the Lagrangian force of the linearized problem to d_f_idx, either
+     * via the Lagrangian data manager or via the sparse spreading operator.
+     */
+    void spreadLinearizedForce(double data_time);
+
+    /*!
+     * Interpolate the linearized Eulerian velocity stored in d_u_idx, either
+     * via the Lagrangian data manager or via the sparse interpolation operator.
+     */
+    void interpolateLinearizedVelocity(bool homogeneous_bc, double data_time);
+
     // Eulerian data for storing u and p DOFs indexing.
     std::vector<std::vector<int> > d_num_dofs_per_proc;
     int d_u_dof_index_idx, d_p_dof_index_idx;
@@ -375,6 +398,12 @@ private:
     KSP d_schur_solver;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_u_scratch_vec, d_f_scratch_vec;
     Vec d_X_current;
+
+    // Sparse Lagrangian-Eulerian coupling operators and associated vectors and
+    // communication schedules.
+    bool d_use_sparse_LE_ops;
+    Vec d_u_LE_vec, d_f_LE_vec;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_f_LE_data_synch_sched, d_f_LE_ghost_fill_sched;
 };
 } // namespace IBAMR
 
@@ -156,6 +156,43 @@ public:
                                    int dof_index_idx,
                                    double data_time) = 0;
 
+    /*!
+     * Construct persistent sparse matrix representations of the IB
+     * interpolation operator J and the IB spreading operator S for the "fixed"
+     * Lagrangian-Eulerian coupling configuration of the structure.  The
+     * operators act on parallel PETSc Vec objects that use the side-centered
+     * DOF indexing specified by \a dof_index_idx on the finest level of the
+     * patch hierarchy.
+     *
+     * \note The default implementation of this method emits an unrecoverable
+     * exception.
+     */
+    virtual void constructLinearizedLEOperators(void (*spread_fnc)(const double, double*),
+                                                int stencil_width,
+                                                const std::vector<int>& num_dofs_per_proc,
+                                                int dof_index_idx,
+                                                double data_time);
+
+    /*!
+     * Spread the Lagrangian force of the linearized problem using the
+     * operators constructed by constructLinearizedLEOperators(), i.e., compute
+     * f_vec := S*F.
+     *
+     * \note The default implementation of this method emits an unrecoverable
+     * exception.
+     */
+    virtual void spreadLinearizedForce(Vec& f_vec);
+
+    /*!
+     * Interpolate the Eulerian velocity using the operators constructed by
+     * constructLinearizedLEOperators(), i.e., compute U := J*u_vec, for use in
+     * evaluating the residual of the linearized problem.
+     *
+     * \note The default implementation of this method emits an unrecoverable
+     * exception.
+     */
+    virtual void interpolateLinearizedVelocity(Vec& u_vec);
+
 protected:
 private:
     /*!
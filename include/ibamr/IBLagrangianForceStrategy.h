@@ -160,6 +160,32 @@ public:
                                                 double data_time,
                                                 IBTK::LDataManager* l_data_manager);
 
+    /*!
+     * \brief Compute the action of the Jacobian of the force with respect to
+     * the present structure configuration and velocity on the perturbation \a
+     * dX_vec, without assembling the Jacobian matrix.
+     *
+     * The action computed by this method must be consistent with the matrix
+     * assembled by computeLagrangianForceJacobian() for the same values of \a
+     * X_coef and \a U_coef.
+     *
+     * \note The result of the Jacobian action must be \em added to \a dF_vec.
+     *
+     * \note A default implementation is provided that results in an assertion
+     * failure.
+     */
+    virtual void
+    computeLagrangianForceJacobianAction(Vec dF_vec,
+                                         Vec dX_vec,
+                                         double X_coef,
+                                         SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                         double U_coef,
+                                         SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                         int level_number,
+                                         double data_time,
+                                         IBTK::LDataManager* l_data_manager);
+
     /*!
      * \brief Compute the potential energy with respect to the present structure
      * configuration and velocity.
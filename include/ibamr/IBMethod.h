@@ -308,6 +308,34 @@ public:
                            int dof_index_idx,
                            double data_time);
 
+    /*!
+     * Construct persistent sparse matrix representations of the IB
+     * interpolation operator J and the IB spreading operator S = J^T/dV for the
+     * "fixed" Lagrangian-Eulerian coupling configuration of the structure.
+     *
+     * \note The operators only couple the Lagrangian data to the finest level
+     * of the patch hierarchy, and they do not account for physical boundary
+     * conditions.  They are intended for structures that remain away from
+     * non-periodic physical boundaries and coarse-fine interfaces.
+     */
+    void constructLinearizedLEOperators(void (*spread_fnc)(const double, double*),
+                                        int stencil_width,
+                                        const std::vector<int>& num_dofs_per_proc,
+                                        int dof_index_idx,
+                                        double data_time);
+
+    /*!
+     * Spread the Lagrangian force of the linearized problem using the sparse
+     * spreading operator, i.e., compute f_vec := S*F.
+     */
+    void spreadLinearizedForce(Vec& f_vec);
+
+    /*!
+     * Interpolate the Eulerian velocity using the sparse interpolation
+     * operator, i.e., compute U := J*u_vec.
+     */
+    void interpolateLinearizedVelocity(Vec& u_vec);
+
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
      */
@@ -501,6 +529,14 @@ protected:
 
     PetscErrorCode computeForce(Vec X, Vec F);
 
+    /*
+     * PETSc function for evaluating the matrix-free action of the Lagrangian
+     * force Jacobian.
+     */
+    static PetscErrorCode applyForceJacobian_SAMRAI(Mat A, Vec X, Vec F);
+
+    PetscErrorCode applyForceJacobian(Vec X, Vec F);
+
     /*
      * Indicates whether the integrator should output logging messages.
      */
@@ -666,9 +702,14 @@ private:
     /*!
      * Jacobian data.
      */
-    bool d_force_jac_mffd;
+    bool d_force_jac_mffd, d_force_jac_matrix_free;
     Mat d_force_jac;
     double d_force_jac_data_time;
+
+    /*
+     * Sparse Lagrangian-Eulerian coupling operators.
+     */
+    Mat d_J_LE_mat, d_S_LE_mat;
 };
 } // namespace IBAMR
 
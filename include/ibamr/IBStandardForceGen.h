@@ -79,6 +79,17 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * \note Springs that use default_spring_force() and all beams are evaluated by
+ * specialized kernels that inline the linear force laws.  These kernels
+ * process the force specifications in fixed-width groups that are ordered by a
+ * greedy coloring of the spring and beam connectivity, so that no two
+ * specifications within a color share a node.  This permits the forces within
+ * a group to be scattered without write conflicts, and it permits the groups
+ * within a color to be processed concurrently when IBAMR is configured with
+ * <code>--enable-openmp</code>.  The specialized kernels may be disabled by
+ * setting the input database key <code>use_specialized_linear_force_kernels</code>
+ * to FALSE.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -164,6 +175,24 @@ public:
                                         double data_time,
                                         IBTK::LDataManager* l_data_manager);
 
+    /*!
+     * \brief Compute the action of the Jacobian of the force with respect to
+     * the present structure configuration on the perturbation \a dX_vec
+     * without assembling the Jacobian matrix.
+     *
+     * \note The result of the Jacobian action is \em added to \a dF_vec.
+     */
+    void computeLagrangianForceJacobianAction(Vec dF_vec,
+                                              Vec dX_vec,
+                                              double X_coef,
+                                              SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                              double U_coef,
+                                              SAMRAI::tbox::Pointer<IBTK::LData> U_data,
+                                              SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                              int level_number,
+                                              double data_time,
+                                              IBTK::LDataManager* l_data_manager);
+
     /*!
      * \brief Compute the potential energy with respect to the present structure
      * configuration and velocity.
@@ -208,6 +237,12 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // Springs [0,linear_color_offsets.back()) use the default linear
+        // spring force law and are grouped by color; springs in
+        // [linear_color_offsets[c],linear_color_offsets[c+1]) do not share
+        // any nodes.
+        std::vector<int> linear_color_offsets;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -217,6 +252,10 @@ private:
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_next_node_idxs, petsc_global_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+
+        // Beams in [color_offsets[c],color_offsets[c+1]) do not share any
+        // nodes.
+        std::vector<int> color_offsets;
     };
     std::vector<BeamData> d_beam_data;
 
@@ -229,6 +268,7 @@ private:
     std::vector<TargetPointData> d_target_point_data;
 
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_X_ghost_data, d_F_ghost_data, d_dX_data;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_V_ghost_data; // perturbations used by Jacobian actions
     std::vector<bool> d_is_initialized;
     //\}
 
@@ -264,6 +304,18 @@ private:
                                     double data_time,
                                     IBTK::LDataManager* l_data_manager);
 
+    /*!
+     * Reorder the cached spring and beam data so that force specifications
+     * that do not share any nodes are stored contiguously.
+     */
+    void initializeSpringAndBeamColoring(int level_number, int num_ghosted_nodes);
+
+    /*!
+     * Specialized kernels for linear springs and beams.
+     */
+    void computeLinearSpringForce(double* F_node, const double* X_node, int level_number);
+    void computeLinearBeamForce(double* F_node, const double* X_node, int level_number);
+
     /*!
      * TargetPoint force routines.
      */
@@ -291,6 +343,12 @@ private:
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements;
+
+    /*!
+     * \brief Whether to use the specialized kernels for linear springs and
+     * beams.
+     */
+    bool d_use_specialized_linear_force_kernels;
 };
 } // namespace IBAMR
 
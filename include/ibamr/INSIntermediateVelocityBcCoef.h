@@ -149,6 +149,19 @@ public:
      */
     void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Indicate whether the coefficients may be cached.  This is the
+     * case when the velocity boundary condition coefficients for this
+     * component are cacheable.
+     */
+    bool getBcCoefsAreCacheable() const;
+
+    /*!
+     * \brief Indicate whether the velocity boundary condition coefficients for
+     * this component are independent of the fill time.
+     */
+    bool getBcCoefsAreTimeIndependent() const;
+
     //\}
 
     /*!
@@ -145,6 +145,20 @@ public:
      */
     void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Indicate whether the coefficients may be cached.  This is the
+     * case when the velocity boundary condition coefficients are cacheable and
+     * time independent, because the pressure coefficients are always evaluated
+     * at the solution time rather than at the fill time.
+     */
+    bool getBcCoefsAreCacheable() const;
+
+    /*!
+     * \brief Indicate whether the coefficients are independent of the fill
+     * time.
+     */
+    bool getBcCoefsAreTimeIndependent() const;
+
     //\}
 
     /*!
@@ -38,9 +38,13 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "FaceData.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "SideData.h"
 #include "SideVariable.h"
+#include "boost/array.hpp"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/ibamr_enums.h"
@@ -72,6 +76,13 @@ namespace IBAMR
  * a side-centered velocity field using the xsPPM7 method of Rider, Greenough,
  * and Kamm.
  *
+ * In three spatial dimensions, setting the input database key
+ * <code>use_fused_convective_kernel</code> to <code>TRUE</code> causes the
+ * convective derivative to be evaluated directly from the Godunov-extrapolated
+ * velocities in a single tiled pass per velocity component.  The tile size may
+ * be specified via <code>fused_kernel_tile_size</code> (default: 16 in each
+ * direction).  These options are ignored in two spatial dimensions.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class INSStaggeredPPMConvectiveOperator : public ConvectiveOperator
@@ -186,12 +197,37 @@ private:
      */
     INSStaggeredPPMConvectiveOperator& operator=(const INSStaggeredPPMConvectiveOperator& that);
 
+    /*
+     * Patch-local scratch data used by applyConvectiveOperator().  These data
+     * are allocated the first time that the operator is applied to each patch
+     * and are retained until the operator state is deallocated.
+     */
+    struct PatchScratchData
+    {
+        SAMRAI::hier::Box<NDIM> patch_box;
+        boost::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceData<NDIM, double> >, NDIM> U_adv_data, U_half_data;
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dU_data, U_L_data, U_R_data, U_scratch1_data,
+            U_scratch2_data;
+    };
+
+    /*!
+     * \brief Return the scratch data associated with the specified patch,
+     * (re)allocating them if necessary.
+     */
+    PatchScratchData& getPatchScratchData(int ln,
+                                          int patch_num,
+                                          const SAMRAI::pdat::SideData<NDIM, double>& U_data);
+
     // Boundary condition helper object.
     SAMRAI::tbox::Pointer<StaggeredStokesPhysicalBoundaryHelper> d_bc_helper;
 
     // Cached communications operators.
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_bc_coefs;
     std::string d_bdry_extrap_type;
+
+    // Fused kernel configuration.
+    bool d_use_fused_convective_kernel;
+    SAMRAI::hier::IntVector<NDIM> d_fused_kernel_tile_size;
     std::vector<IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent> d_transaction_comps;
     SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation> d_hier_bdry_fill;
 
@@ -202,6 +238,7 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx;
+    std::vector<std::vector<PatchScratchData> > d_patch_scratch_data;
 };
 } // namespace IBAMR
 
@@ -38,8 +38,11 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "FaceData.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "SideData.h"
 #include "SideVariable.h"
 #include "boost/array.hpp"
 #include "ibamr/ConvectiveOperator.h"
@@ -190,6 +193,30 @@ private:
      */
     INSStaggeredStabilizedPPMConvectiveOperator& operator=(const INSStaggeredStabilizedPPMConvectiveOperator& that);
 
+    /*
+     * Patch-local scratch data used by applyConvectiveOperator().  These data
+     * are allocated the first time that the operator is applied to each patch
+     * and are retained until the operator state is deallocated.
+     */
+    struct PatchScratchData
+    {
+        SAMRAI::hier::Box<NDIM> patch_box;
+        boost::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceData<NDIM, double> >, NDIM> U_adv_data, U_half_data,
+            U_half_upwind_data;
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dU_data, U_L_data, U_R_data, U_scratch1_data,
+            U_scratch2_data;
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > N_upwind_data, N_PPM_data;
+    };
+
+    /*!
+     * \brief Return the scratch data associated with the specified patch,
+     * (re)allocating them if necessary.
+     */
+    PatchScratchData& getPatchScratchData(int ln,
+                                          int patch_num,
+                                          const SAMRAI::pdat::SideData<NDIM, double>& U_data,
+                                          const SAMRAI::pdat::SideData<NDIM, double>& N_data);
+
     // Operator configuration.
     std::string d_stabilization_type;
     boost::array<bool, 2 * NDIM> d_open_bdry;
@@ -211,6 +238,7 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx;
+    std::vector<std::vector<PatchScratchData> > d_patch_scratch_data;
 };
 } // namespace IBAMR
 
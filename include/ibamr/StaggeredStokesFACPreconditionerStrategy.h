@@ -105,6 +105,8 @@ namespace IBAMR
  coarse_solver_rel_residual_tol = 1.0e-5        // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50       // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10              // see setCoarseSolverMaxIterations()
+ num_geometric_coarse_levels = 0                // see setNumGeometricCoarseLevels()
+ geometric_coarse_level_min_box_size = 8        // see setGeometricCoarseLevelMinBoxSize()
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
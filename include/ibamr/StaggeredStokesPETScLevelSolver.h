@@ -72,6 +72,26 @@ namespace IBAMR
  * for a staggered-grid (MAC) discretization of the incompressible Stokes
  * equations.
  *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ amg_type = ""                 // if "gamg" or "boomeramg", precondition with a
+                               // Schur-complement field split preconditioner
+                               // using algebraic multigrid for each split
+ \endverbatim
+ *
+ * Parameters recognized by PETScLevelSolver are also supported.
+ *
+ * When \p amg_type is set, the assembled MAC Stokes operator is preconditioned
+ * by an upper block-triangular Schur-complement factorization in which the
+ * pressure Schur complement is approximated by \f$ A_{pp} - A_{pu}
+ * \mbox{diag}(A_{uu})^{-1} A_{up} \f$.  Both the velocity block and the
+ * approximate Schur complement are solved by a single application of the
+ * requested algebraic multigrid preconditioner.  The multigrid setup is
+ * performed once by initializeSolverState() and is reused by all subsequent
+ * solves.  The sub-solvers may be further configured from the PETSc options
+ * database via the prefixes \p fieldsplit_velocity_ and \p fieldsplit_pressure_.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class StaggeredStokesPETScLevelSolver : public IBTK::PETScLevelSolver, public StaggeredStokesSolver
@@ -100,6 +120,16 @@ public:
         return new StaggeredStokesPETScLevelSolver(object_name, input_db, default_options_prefix);
     } // allocate_solver
 
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * In addition to the setup performed by
+     * PETScLevelSolver::initializeSolverState(), this routine configures the
+     * algebraic multigrid field split preconditioner if one has been requested.
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
 protected:
     /*!
      * \brief Generate IS/subdomains for Schwartz type preconditioners.
@@ -171,6 +201,13 @@ private:
      */
     StaggeredStokesPETScLevelSolver& operator=(const StaggeredStokesPETScLevelSolver& that);
 
+    /*!
+     * \brief Configure the Schur-complement field split preconditioner to use
+     * algebraic multigrid for the velocity block and the approximate Schur
+     * complement.
+     */
+    void setupAMGFieldSplitPreconditioner();
+
     /*!
      * \name PETSc objects.
      */
@@ -187,6 +224,12 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_data_synch_sched, d_ghost_fill_sched;
 
     //\}
+
+    /*!
+     * \brief Algebraic multigrid type used by the field split preconditioner
+     * (empty if not used).
+     */
+    std::string d_amg_type;
 };
 } // namespace IBAMR
 
@@ -79,6 +79,8 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to a MAC
      * discretization of the time-dependent incompressible Stokes equations on a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * \see IBTK::PETScMatUtilities::reusePatchLevelMatStructure()
      */
     static void constructPatchLevelMACStokesOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
@@ -87,7 +89,8 @@ public:
                                                const std::vector<int>& num_dofs_per_proc,
                                                int u_dof_index_idx,
                                                int p_dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Partition the patch level into subdomains suitable to be used for
@@ -0,0 +1,33 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "==================================="
+echo "Configuring optional OpenMP support"
+echo "==================================="
+
+PACKAGE_SETUP_ENVIRONMENT
+
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable OpenMP threading of IB force and FE stress evaluations @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+if test "$OPENMP_ENABLED" = yes; then
+  AC_OPENMP
+  if test "$ac_cv_prog_cxx_openmp" = unsupported ; then
+    AC_MSG_ERROR([--enable-openmp is specified, but the C++ compiler does not support OpenMP])
+  fi
+  PACKAGE_CXXFLAGS_PREPEND($OPENMP_CXXFLAGS)
+  PACKAGE_LDFLAGS_PREPEND($OPENMP_CXXFLAGS)
+  AC_MSG_NOTICE([OpenMP support is ENABLED; batched IBFE stress functions must be thread safe])
+else
+  AC_MSG_NOTICE([OpenMP support is DISABLED])
+fi
+
+PACKAGE_RESTORE_ENVIRONMENT
+
+])
@@ -193,6 +193,47 @@ has_physical_bdry(const Elem* elem, const BoundaryInfo& boundary_info, const Dof
     return has_physical_bdry;
 }
 
+// Number of elements whose quadrature point data are gathered together before
+// the PK1 stress is evaluated.
+static const unsigned int PK1_STRESS_ELEM_BLOCK_SIZE = 256;
+
+inline void
+evaluate_PK1_stress(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& X,
+                    const libMesh::Point& s,
+                    Elem* const elem,
+                    const IBFEMethod::PK1StressFcnData& fcn_data,
+                    const std::vector<NumericVector<double>*>& system_data,
+                    const double data_time)
+{
+    if (fcn_data.fcn)
+    {
+        fcn_data.fcn(PP, FF, X, s, elem, system_data, data_time, fcn_data.ctx);
+        return;
+    }
+    double PP_arr[NDIM * NDIM], FF_arr[NDIM * NDIM], X_arr[NDIM], s_arr[NDIM];
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            FF_arr[NDIM * i + j] = FF(i, j);
+        }
+        X_arr[i] = X(i);
+        s_arr[i] = s(i);
+    }
+    fcn_data.batch_fcn(PP_arr, FF_arr, X_arr, s_arr, 1, elem, system_data, data_time, fcn_data.ctx);
+    PP.zero();
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            PP(i, j) = PP_arr[NDIM * i + j];
+        }
+    }
+    return;
+} // evaluate_PK1_stress
+
 std::string
 libmesh_restart_file_name(const std::string& restart_dump_dirname,
                           unsigned int time_step_number,
@@ -306,6 +347,7 @@ IBFEMethod::registerPK1StressFunction(const PK1StressFcnData& data, const unsign
 {
     TBOX_ASSERT(part < d_num_parts);
     d_PK1_stress_fcn_data[part].push_back(data);
+    d_PK1_stress_ref_shape_data[part].resize(d_PK1_stress_fcn_data[part].size());
     if (data.quad_type == INVALID_Q_RULE)
     {
         d_PK1_stress_fcn_data[part].back().quad_type = d_quad_type;
@@ -319,6 +361,20 @@ IBFEMethod::registerPK1StressFunction(const PK1StressFcnData& data, const unsign
     return;
 } // registerPK1StressFunction
 
+void
+IBFEMethod::registerPK1StressBatchFunction(PK1StressBatchFcnPtr fcn,
+                                           const std::vector<unsigned int>& systems,
+                                           void* ctx,
+                                           QuadratureType quad_type,
+                                           Order quad_order,
+                                           const unsigned int part)
+{
+    PK1StressFcnData data(NULL, systems, ctx, quad_type, quad_order);
+    data.batch_fcn = fcn;
+    registerPK1StressFunction(data, part);
+    return;
+} // registerPK1StressBatchFunction
+
 void
 IBFEMethod::registerLagBodyForceFunction(LagBodyForceFcnPtr fcn,
                                          const std::vector<unsigned int>& systems,
@@ -553,6 +609,11 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
         X_vec->localize(*X_ghost_vec);
         d_fe_data_managers[part]->interp(
             u_data_idx, *U_vec, *X_ghost_vec, VELOCITY_SYSTEM_NAME, u_ghost_fill_scheds, data_time);
+        if (d_do_log && d_interp_spec.use_consistent_mass_matrix)
+        {
+            plog << d_object_name << "::interpolateVelocity(): L2 projection for part " << part << " required "
+                 << d_fe_data_managers[part]->getL2ProjectionIterations(VELOCITY_SYSTEM_NAME) << " iterations\n";
+        }
     }
     return;
 } // interpolateVelocity
@@ -811,6 +872,7 @@ void IBFEMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierar
 void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                        Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
+    clearReferenceShapeData();
     if (d_is_initialized)
     {
         for (unsigned int part = 0; part < d_num_parts; ++part)
@@ -830,6 +892,7 @@ IBFEMethod::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                 Pointer<BasePatchLevel<NDIM> > old_level,
                                 bool allocate_data)
 {
+    clearReferenceShapeData();
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
@@ -851,6 +914,7 @@ IBFEMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hiera
                                         int coarsest_level,
                                         int /*finest_level*/)
 {
+    clearReferenceShapeData();
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
@@ -992,7 +1056,7 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     // First handle the stress contributions.
     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        if (!d_PK1_stress_fcn_data[part][k].fcn && !d_PK1_stress_fcn_data[part][k].batch_fcn) continue;
 
         AutoPtr<QBase> qrule =
             QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
@@ -1036,116 +1100,360 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
         //
         // This right-hand side vector is used to solve for the nodal values of
         // the interior elastic force density.
+        //
+        // The elements are processed in blocks.  For each block, we first
+        // gather the deformation gradients and the weighted shape function
+        // gradients at all of the quadrature points, then evaluate the stress
+        // (one call per element when a batched stress function is registered),
+        // and finally contract the stresses against the shape function
+        // gradients.  The last two phases are threaded over the elements of
+        // the block when OpenMP is enabled.
+        const bool use_batch_fcn = !d_PK1_stress_fcn_data[part][k].fcn;
         TensorValue<double> PP, FF, FF_inv_trans;
         VectorValue<double> F, F_qp, n;
-        libMesh::Point X_qp;
+        libMesh::Point X_qp, s_qp;
         boost::multi_array<double, 2> X_node;
-        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+        std::vector<Elem*> block_elems;
+        std::vector<size_t> block_qp_offset, block_basis_offset, block_dphi_offset;
+        std::vector<double> block_FF, block_PP, block_X, block_s, block_dphi_JxW, block_G_rhs;
+
+        // The reference-configuration shape function data are either taken
+        // from the cache or computed and (if possible) recorded in the cache.
+        //
+        // NOTE: Cached data are reused only if the local elements are the same
+        // elements, in the same order, as those for which they were recorded.
+        ReferenceShapeData& ref_data = d_PK1_stress_ref_shape_data[part][k];
+        if (ref_data.valid)
         {
-            Elem* const elem = *el_it;
-            fe->reinit(elem);
-            for (unsigned int d = 0; d < NDIM; ++d)
+            bool same_elems = ref_data.elem_id.size() == mesh.n_active_local_elem();
+            unsigned int e = 0;
+            for (MeshBase::const_element_iterator it = mesh.active_local_elements_begin();
+                 same_elems && it != mesh.active_local_elements_end();
+                 ++it, ++e)
             {
-                dof_map.dof_indices(elem, dof_indices[d], d);
-                G_rhs_e[d].resize(static_cast<int>(dof_indices[d].size()));
+                same_elems = ref_data.elem_id[e] == (*it)->id();
             }
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dof_indices[0].size();
-            get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            if (!same_elems)
             {
-                const libMesh::Point& s_qp = q_point[qp];
-                interpolate(X_qp, qp, X_node, phi);
-                jacobian(FF, qp, X_node, dphi);
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, X_qp, s_qp, elem, PK1_stress_fcn_data[k], data_time, d_PK1_stress_fcn_data[part][k].ctx);
-                for (unsigned int k = 0; k < n_basis; ++k)
+                d_reference_shape_data_size -= ref_data.num_bytes;
+                ref_data = ReferenceShapeData();
+            }
+        }
+        bool record_ref_data = d_cache_reference_shape_data && !ref_data.valid && !ref_data.disabled;
+        const size_t max_ref_data_bytes = static_cast<size_t>(d_max_reference_shape_data_size * 1024.0 * 1024.0);
+        std::vector<double> elem_phi, elem_dphi, elem_JxW, elem_s;
+        unsigned int elem_idx = 0;
+        MeshBase::const_element_iterator el_it = mesh.active_local_elements_begin();
+        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
+        while (el_it != el_end)
+        {
+            block_elems.clear();
+            block_qp_offset.assign(1, 0);
+            block_basis_offset.assign(1, 0);
+            block_dphi_offset.assign(1, 0);
+            for (; el_it != el_end && block_elems.size() < PK1_STRESS_ELEM_BLOCK_SIZE; ++el_it, ++elem_idx)
+            {
+                Elem* const elem = *el_it;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    dof_map.dof_indices(elem, dof_indices[d], d);
+                }
+                const size_t n_basis = dof_indices[0].size();
+                unsigned int n_qp;
+                const double *phi_e, *dphi_e, *JxW_e, *s_e;
+                if (ref_data.valid)
+                {
+                    n_qp = ref_data.n_qp[elem_idx];
+                    phi_e = &ref_data.phi[ref_data.phi_offset[elem_idx]];
+                    dphi_e = &ref_data.dphi[NDIM * ref_data.phi_offset[elem_idx]];
+                    JxW_e = &ref_data.JxW[ref_data.qp_offset[elem_idx]];
+                    s_e = &ref_data.q_point[NDIM * ref_data.qp_offset[elem_idx]];
+                }
+                else
+                {
+                    fe->reinit(elem);
+                    n_qp = qrule->n_points();
+                    elem_phi.resize(n_basis * n_qp);
+                    elem_dphi.resize(NDIM * n_basis * n_qp);
+                    elem_JxW.resize(n_qp);
+                    elem_s.resize(NDIM * n_qp);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        for (unsigned int l = 0; l < n_basis; ++l)
+                        {
+                            elem_phi[n_qp * l + qp] = phi[l][qp];
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                elem_dphi[NDIM * (n_qp * l + qp) + j] = dphi[l][qp](j);
+                            }
+                        }
+                        elem_JxW[qp] = JxW[qp];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            elem_s[NDIM * qp + i] = q_point[qp](i);
+                        }
+                    }
+                    if (record_ref_data)
+                    {
+                        ref_data.elem_id.push_back(elem->id());
+                        ref_data.n_qp.push_back(n_qp);
+                        ref_data.qp_offset.push_back(ref_data.JxW.size());
+                        ref_data.phi_offset.push_back(ref_data.phi.size());
+                        ref_data.phi.insert(ref_data.phi.end(), elem_phi.begin(), elem_phi.end());
+                        ref_data.dphi.insert(ref_data.dphi.end(), elem_dphi.begin(), elem_dphi.end());
+                        ref_data.JxW.insert(ref_data.JxW.end(), elem_JxW.begin(), elem_JxW.end());
+                        ref_data.q_point.insert(ref_data.q_point.end(), elem_s.begin(), elem_s.end());
+                        ref_data.num_bytes =
+                            sizeof(double) *
+                                (ref_data.phi.size() + ref_data.dphi.size() + ref_data.JxW.size() +
+                                 ref_data.q_point.size()) +
+                            (sizeof(libMesh::dof_id_type) + sizeof(unsigned int) + 2 * sizeof(size_t)) *
+                                ref_data.n_qp.size();
+                        if (d_reference_shape_data_size + ref_data.num_bytes > max_ref_data_bytes)
+                        {
+                            // The cache would exceed the memory budget, so
+                            // compute these data on the fly from now on.
+                            ref_data = ReferenceShapeData();
+                            ref_data.disabled = true;
+                            record_ref_data = false;
+                        }
+                    }
+                    phi_e = &elem_phi[0];
+                    dphi_e = &elem_dphi[0];
+                    JxW_e = &elem_JxW[0];
+                    s_e = &elem_s[0];
+                }
+                const size_t qp_offset = block_qp_offset.back();
+                const size_t dphi_offset = block_dphi_offset.back();
+                block_FF.resize(NDIM * NDIM * (qp_offset + n_qp));
+                block_X.resize(NDIM * (qp_offset + n_qp));
+                block_s.resize(NDIM * (qp_offset + n_qp));
+                block_dphi_JxW.resize(dphi_offset + NDIM * n_basis * n_qp);
+                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    F_qp = -PP * dphi[k][qp] * JxW[qp];
+                    const size_t q = qp_offset + qp;
+                    double* const FF_q = &block_FF[NDIM * NDIM * q];
+                    double* const X_q = &block_X[NDIM * q];
+                    std::fill(FF_q, FF_q + NDIM * NDIM, 0.0);
+                    std::fill(X_q, X_q + NDIM, 0.0);
+                    for (unsigned int l = 0; l < n_basis; ++l)
+                    {
+                        const double phi_lq = phi_e[n_qp * l + qp];
+                        const double* const dphi_lq = &dphi_e[NDIM * (n_qp * l + qp)];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            const double X = X_node[l][i];
+                            X_q[i] += X * phi_lq;
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                FF_q[NDIM * i + j] += X * dphi_lq[j];
+                            }
+                        }
+                        for (unsigned int j = 0; j < NDIM; ++j)
+                        {
+                            block_dphi_JxW[dphi_offset + NDIM * (n_qp * l + qp) + j] = dphi_lq[j] * JxW_e[qp];
+                        }
+                    }
                     for (unsigned int i = 0; i < NDIM; ++i)
                     {
-                        G_rhs_e[i](k) += F_qp(i);
+                        block_s[NDIM * q + i] = s_e[NDIM * qp + i];
                     }
                 }
+                block_elems.push_back(elem);
+                block_qp_offset.push_back(qp_offset + n_qp);
+                block_basis_offset.push_back(block_basis_offset.back() + n_basis);
+                block_dphi_offset.push_back(dphi_offset + NDIM * n_basis * n_qp);
             }
+            const int n_block_elems = static_cast<int>(block_elems.size());
 
-            // Loop over the element boundaries.
-            for (unsigned short int side = 0; side < elem->n_sides(); ++side)
+            // Compute the values of the first Piola-Kirchhoff stress tensor at
+            // the quadrature points.
+            block_PP.resize(block_FF.size());
+            if (use_batch_fcn)
             {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
-
-                // Determine if we need to compute surface forces along this
-                // part of the physical boundary; if not, skip the present side.
-                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, dof_map);
-                const bool compute_transmission_force =
-                    (d_split_forces && !at_dirichlet_bdry) || (!d_split_forces && at_dirichlet_bdry);
-                if (!compute_transmission_force) continue;
-
-                fe_face->reinit(elem, side);
-                const unsigned int n_qp = qrule_face->n_points();
-                const size_t n_basis = dof_indices[0].size();
-                get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
-                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                const PK1StressBatchFcnPtr batch_fcn = d_PK1_stress_fcn_data[part][k].batch_fcn;
+                void* const ctx = d_PK1_stress_fcn_data[part][k].ctx;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+                for (int e = 0; e < n_block_elems; ++e)
                 {
-                    const libMesh::Point& s_qp = q_point_face[qp];
-                    interpolate(X_qp, qp, X_node, phi_face);
-                    jacobian(FF, qp, X_node, dphi_face);
-                    F.zero();
-
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    const size_t q = block_qp_offset[e];
+                    const unsigned int n_qp = static_cast<unsigned int>(block_qp_offset[e + 1] - q);
+                    batch_fcn(&block_PP[NDIM * NDIM * q],
+                              &block_FF[NDIM * NDIM * q],
+                              &block_X[NDIM * q],
+                              &block_s[NDIM * q],
+                              n_qp,
+                              block_elems[e],
+                              PK1_stress_fcn_data[k],
+                              data_time,
+                              ctx);
+                }
+            }
+            else
+            {
+                for (int e = 0; e < n_block_elems; ++e)
+                {
+                    for (size_t q = block_qp_offset[e]; q < block_qp_offset[e + 1]; ++q)
                     {
+                        FF.zero();
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                FF(i, j) = block_FF[NDIM * NDIM * q + NDIM * i + j];
+                            }
+                            X_qp(i) = block_X[NDIM * q + i];
+                            s_qp(i) = block_s[NDIM * q + i];
+                        }
+                        for (unsigned int i = NDIM; i < LIBMESH_DIM; ++i)
+                        {
+                            FF(i, i) = 1.0;
+                        }
                         d_PK1_stress_fcn_data[part][k].fcn(PP,
                                                            FF,
                                                            X_qp,
                                                            s_qp,
-                                                           elem,
+                                                           block_elems[e],
                                                            PK1_stress_fcn_data[k],
                                                            data_time,
                                                            d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
-                    }
-
-                    // If we are imposing jump conditions, then we keep only the
-                    // normal part of the force.  This has the effect of
-                    // projecting the tangential part of the surface force (but
-                    // not the normal part) onto the interior force density.
-                    if (d_use_jump_conditions && d_split_forces && !at_dirichlet_bdry)
-                    {
-                        tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-                        n = (FF_inv_trans * normal_face[qp]).unit();
-                        F = (F * n) * n;
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                block_PP[NDIM * NDIM * q + NDIM * i + j] = PP(i, j);
+                            }
+                        }
                     }
+                }
+            }
 
-                    // Add the boundary forces to the right-hand-side vector.
-                    for (unsigned int k = 0; k < n_basis; ++k)
+            // Compute the forces corresponding to the stresses.
+            block_G_rhs.resize(NDIM * block_basis_offset.back());
+#if defined(_OPENMP)
+#pragma omp parallel for
+#endif
+            for (int e = 0; e < n_block_elems; ++e)
+            {
+                const size_t qp_offset = block_qp_offset[e];
+                const size_t n_qp = block_qp_offset[e + 1] - qp_offset;
+                const size_t basis_offset = block_basis_offset[e];
+                const size_t n_basis = block_basis_offset[e + 1] - basis_offset;
+                const double* const dphi_JxW = &block_dphi_JxW[block_dphi_offset[e]];
+                for (size_t l = 0; l < n_basis; ++l)
+                {
+                    double G[NDIM];
+                    std::fill(G, G + NDIM, 0.0);
+                    for (size_t qp = 0; qp < n_qp; ++qp)
                     {
-                        F_qp = phi_face[k][qp] * JxW_face[qp] * F;
+                        const double* const PP_qp = &block_PP[NDIM * NDIM * (qp_offset + qp)];
+                        const double* const dphi_JxW_qp = &dphi_JxW[NDIM * (n_qp * l + qp)];
                         for (unsigned int i = 0; i < NDIM; ++i)
                         {
-                            G_rhs_e[i](k) += F_qp(i);
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                G[i] -= PP_qp[NDIM * i + j] * dphi_JxW_qp[j];
+                            }
                         }
                     }
+                    for (unsigned int i = 0; i < NDIM; ++i)
+                    {
+                        block_G_rhs[NDIM * (basis_offset + l) + i] = G[i];
+                    }
                 }
             }
 
-            // Apply constraints (e.g., enforce periodic boundary conditions)
-            // and add the elemental contributions to the global vector.
-            for (unsigned int i = 0; i < NDIM; ++i)
+            for (int e = 0; e < n_block_elems; ++e)
             {
-                dof_map.constrain_element_vector(G_rhs_e[i], dof_indices[i]);
-                G_rhs_vec->add_vector(G_rhs_e[i], dof_indices[i]);
+                Elem* const elem = block_elems[e];
+                const size_t basis_offset = block_basis_offset[e];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    dof_map.dof_indices(elem, dof_indices[d], d);
+                    G_rhs_e[d].resize(static_cast<int>(dof_indices[d].size()));
+                    for (unsigned int l = 0; l < dof_indices[d].size(); ++l)
+                    {
+                        G_rhs_e[d](l) = block_G_rhs[NDIM * (basis_offset + l) + d];
+                    }
+                }
+
+                // Loop over the element boundaries.
+                for (unsigned short int side = 0; side < elem->n_sides(); ++side)
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, dof_map)) continue;
+
+                    // Determine if we need to compute surface forces along this
+                    // part of the physical boundary; if not, skip the present side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, dof_map);
+                    const bool compute_transmission_force =
+                        (d_split_forces && !at_dirichlet_bdry) || (!d_split_forces && at_dirichlet_bdry);
+                    if (!compute_transmission_force) continue;
+
+                    fe_face->reinit(elem, side);
+                    const unsigned int n_qp = qrule_face->n_points();
+                    const size_t n_basis = dof_indices[0].size();
+                    get_values_for_interpolation(X_node, *X_petsc_vec, X_local_soln, dof_indices);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        const libMesh::Point& s_face_qp = q_point_face[qp];
+                        interpolate(X_qp, qp, X_node, phi_face);
+                        jacobian(FF, qp, X_node, dphi_face);
+                        F.zero();
+
+                        // Compute the value of the first Piola-Kirchhoff stress
+                        // tensor at the quadrature point and add the corresponding
+                        // force to the right-hand-side vector.
+                        evaluate_PK1_stress(PP,
+                                            FF,
+                                            X_qp,
+                                            s_face_qp,
+                                            elem,
+                                            d_PK1_stress_fcn_data[part][k],
+                                            PK1_stress_fcn_data[k],
+                                            data_time);
+                        F += PP * normal_face[qp];
+
+                        // If we are imposing jump conditions, then we keep only the
+                        // normal part of the force.  This has the effect of
+                        // projecting the tangential part of the surface force (but
+                        // not the normal part) onto the interior force density.
+                        if (d_use_jump_conditions && d_split_forces && !at_dirichlet_bdry)
+                        {
+                            tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                            n = (FF_inv_trans * normal_face[qp]).unit();
+                            F = (F * n) * n;
+                        }
+
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int k = 0; k < n_basis; ++k)
+                        {
+                            F_qp = phi_face[k][qp] * JxW_face[qp] * F;
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                G_rhs_e[i](k) += F_qp(i);
+                            }
+                        }
+                    }
+                }
+
+                // Apply constraints (e.g., enforce periodic boundary conditions)
+                // and add the elemental contributions to the global vector.
+                for (unsigned int i = 0; i < NDIM; ++i)
+                {
+                    dof_map.constrain_element_vector(G_rhs_e[i], dof_indices[i]);
+                    G_rhs_vec->add_vector(G_rhs_e[i], dof_indices[i]);
+                }
             }
         }
+        if (record_ref_data)
+        {
+            ref_data.valid = true;
+            d_reference_shape_data_size += ref_data.num_bytes;
+        }
     }
 
     // Now account for any body or surface force contributions.
@@ -1331,6 +1639,11 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
 
     // Solve for G.
     d_fe_data_managers[part]->computeL2Projection(G_vec, *G_rhs_vec, FORCE_SYSTEM_NAME, d_use_consistent_mass_matrix);
+    if (d_do_log && d_use_consistent_mass_matrix)
+    {
+        plog << d_object_name << "::computeInteriorForceDensity(): L2 projection for part " << part << " required "
+             << d_fe_data_managers[part]->getL2ProjectionIterations(FORCE_SYSTEM_NAME) << " iterations\n";
+    }
     return;
 } // computeInteriorForceDensity
 
@@ -1531,19 +1844,19 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               X_qp,
-                                                               s_qp,
-                                                               elem,
-                                                               PK1_stress_fcn_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluate_PK1_stress(PP,
+                                                FF,
+                                                X_qp,
+                                                s_qp,
+                                                elem,
+                                                d_PK1_stress_fcn_data[part][k],
+                                                PK1_stress_fcn_data[k],
+                                                data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -1919,19 +2232,19 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_stress_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               X_qp,
-                                                               s_qp,
-                                                               elem,
-                                                               PK1_stress_fcn_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluate_PK1_stress(PP,
+                                                FF,
+                                                X_qp,
+                                                s_qp,
+                                                elem,
+                                                d_PK1_stress_fcn_data[part][k],
+                                                PK1_stress_fcn_data[k],
+                                                data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2081,6 +2394,20 @@ IBFEMethod::updateCoordinateMapping(const unsigned int part)
     return;
 } // updateCoordinateMapping
 
+void
+IBFEMethod::clearReferenceShapeData()
+{
+    for (unsigned int part = 0; part < d_PK1_stress_ref_shape_data.size(); ++part)
+    {
+        for (unsigned int k = 0; k < d_PK1_stress_ref_shape_data[part].size(); ++k)
+        {
+            d_PK1_stress_ref_shape_data[part][k] = ReferenceShapeData();
+        }
+    }
+    d_reference_shape_data_size = 0;
+    return;
+} // clearReferenceShapeData
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -2118,11 +2445,17 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_quad_type = QGAUSS;
     d_quad_order = INVALID_ORDER;
     d_use_consistent_mass_matrix = true;
+    d_element_mapping_displacement_threshold = 0.0;
+    d_L2_projection_solver_type = "DEFAULT";
+    d_cache_reference_shape_data = false;
+    d_max_reference_shape_data_size = 512.0;
+    d_reference_shape_data_size = 0;
     d_do_log = false;
 
     // Initialize function data to NULL.
     d_coordinate_mapping_fcn_data.resize(d_num_parts);
     d_PK1_stress_fcn_data.resize(d_num_parts);
+    d_PK1_stress_ref_shape_data.resize(d_num_parts);
     d_lag_body_force_fcn_data.resize(d_num_parts);
     d_lag_surface_pressure_fcn_data.resize(d_num_parts);
     d_lag_surface_force_fcn_data.resize(d_num_parts);
@@ -2200,6 +2533,8 @@ IBFEMethod::commonConstructor(const std::string& object_name,
         manager_stream << "IBFEMethod FEDataManager::" << part;
         const std::string& manager_name = manager_stream.str();
         d_fe_data_managers[part] = FEDataManager::getManager(manager_name, d_interp_spec, d_spread_spec);
+        d_fe_data_managers[part]->setElementMappingDisplacementThreshold(d_element_mapping_displacement_threshold);
+        d_fe_data_managers[part]->setL2ProjectionSolverType(d_L2_projection_solver_type);
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_fe_data_managers[part]->getGhostCellWidth());
 
         // Create FE equation systems objects and corresponding variables.
@@ -2348,6 +2683,14 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     }
 
     // Other settings.
+    if (db->isString("L2_projection_solver_type"))
+        d_L2_projection_solver_type = db->getString("L2_projection_solver_type");
+    if (db->isDouble("element_mapping_displacement_threshold"))
+        d_element_mapping_displacement_threshold = db->getDouble("element_mapping_displacement_threshold");
+    if (db->isBool("cache_reference_shape_data"))
+        d_cache_reference_shape_data = db->getBool("cache_reference_shape_data");
+    if (db->isDouble("max_reference_shape_data_size"))
+        d_max_reference_shape_data_size = db->getDouble("max_reference_shape_data_size");
     if (db->isInteger("min_ghost_cell_width"))
     {
         d_ghosts = db->getInteger("min_ghost_cell_width");
@@ -619,6 +619,7 @@ IBHierarchyIntegrator::resetHierarchyConfigurationSpecialized(const Pointer<Base
 
     // Reset IB data.
     d_ib_method_ops->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_body_force_fcn) d_body_force_fcn->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
 
     // Reset the Hierarchy data operations for the new hierarchy configuration.
     d_hier_velocity_data_ops->setPatchHierarchy(hierarchy);
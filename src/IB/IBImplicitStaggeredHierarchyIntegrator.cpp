@@ -36,6 +36,7 @@
 #include <ostream>
 #include <string>
 
+#include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "GriddingAlgorithm.h"
@@ -67,6 +68,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/PETScVecUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_enums.h"
 #include "petscerror.h"
@@ -152,6 +154,11 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
     d_solve_for_position = false;
     d_use_structure_predictor = false;
     d_jac_delta_fcn = "IB_4";
+    d_use_sparse_LE_ops = false;
+    d_u_LE_vec = NULL;
+    d_f_LE_vec = NULL;
+    d_f_LE_data_synch_sched = NULL;
+    d_f_LE_ghost_fill_sched = NULL;
 
     // Set options from input.
     if (input_db)
@@ -163,6 +170,15 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
         if (input_db->keyExists("use_structure_predictor"))
             d_use_structure_predictor = input_db->getBool("use_structure_predictor");
         if (input_db->keyExists("jacobian_delta_fcn")) d_jac_delta_fcn = input_db->getString("jacobian_delta_fcn");
+        if (input_db->keyExists("use_sparse_LE_operators"))
+            d_use_sparse_LE_ops = input_db->getBool("use_sparse_LE_operators");
+    }
+
+    if (d_use_sparse_LE_ops && !d_solve_for_position)
+    {
+        TBOX_ERROR(d_object_name << "::IBImplicitStaggeredHierarchyIntegrator():\n"
+                                 << "  use_sparse_LE_operators = TRUE requires eliminate_eulerian_vars = TRUE"
+                                 << std::endl);
     }
 
     if (d_use_structure_predictor)
@@ -237,6 +253,11 @@ IBImplicitStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
             StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
                 d_num_dofs_per_proc[ln], d_u_dof_index_idx, d_p_dof_index_idx, level);
         }
+        if (d_use_sparse_LE_ops && ln == finest_ln)
+        {
+            level->allocatePatchData(d_u_dof_index_idx, current_time);
+            PETScVecUtilities::constructPatchLevelDOFIndices(d_num_dofs_per_proc[ln], d_u_dof_index_idx, level);
+        }
     }
 
     // Initialize IB data.
@@ -380,6 +401,10 @@ IBImplicitStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
             level->deallocatePatchData(d_u_dof_index_idx);
             level->deallocatePatchData(d_p_dof_index_idx);
         }
+        if (d_use_sparse_LE_ops && ln == finest_ln)
+        {
+            level->deallocatePatchData(d_u_dof_index_idx);
+        }
     }
 
     // Execute any registered callbacks.
@@ -394,6 +419,31 @@ IBImplicitStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
 {
     if (d_integrator_is_initialized) return;
 
+    // The sparse Lagrangian-Eulerian coupling operators act only on the
+    // degrees of freedom of a single patch level, and they do not impose
+    // physical boundary conditions.
+    if (d_use_sparse_LE_ops)
+    {
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (periodic_shift(d) == 0)
+            {
+                TBOX_ERROR(d_object_name << "::initializeHierarchyIntegrator():\n"
+                                         << "  use_sparse_LE_operators = TRUE requires a domain that is periodic in "
+                                            "all directions"
+                                         << std::endl);
+            }
+        }
+        if (gridding_alg->getMaxLevels() > 1)
+        {
+            TBOX_ERROR(d_object_name << "::initializeHierarchyIntegrator():\n"
+                                     << "  use_sparse_LE_operators = TRUE requires a uniform grid (max_levels = 1)"
+                                     << std::endl);
+        }
+    }
+
     // Register u and p DOF variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     d_u_dof_index_var = new SideVariable<NDIM, int>(d_object_name + "::u_dof_index");
@@ -518,6 +568,24 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_position(const double
     // should be used for Lagrangian-Eulerian coupling.
     d_ib_implicit_ops->updateFixedLEOperators();
 
+    // Setup Eulerian vectors used to apply the sparse Lagrangian-Eulerian
+    // coupling operators.
+    if (d_use_sparse_LE_ops)
+    {
+        const int n_local_dofs = d_num_dofs_per_proc[finest_ln][SAMRAI_MPI::getRank()];
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, n_local_dofs, PETSC_DETERMINE, &d_u_LE_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDuplicate(d_u_LE_vec, &d_f_LE_vec);
+        IBTK_CHKERRQ(ierr);
+
+        // Side-centered values that are shared by patches assigned to
+        // different processors must be synchronized after they are copied
+        // from the spread force vector.
+        Pointer<PatchLevel<NDIM> > finest_level = d_hierarchy->getPatchLevel(finest_ln);
+        d_f_LE_data_synch_sched = PETScVecUtilities::constructDataSynchSchedule(d_f_idx, finest_level);
+        d_f_LE_ghost_fill_sched = PETScVecUtilities::constructGhostFillSchedule(d_f_idx, finest_level);
+    }
+
     // Setup VecNest objects to store the composite solution and
     // right-hand-side vectors.
     Vec eul_sol_petsc_vec = PETScSAMRAIVectorReal::createPETScVector(eul_sol_vec, PETSC_COMM_WORLD);
@@ -630,6 +698,15 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_position(const double
     IBTK_CHKERRQ(ierr);
     ierr = VecDestroy(&lag_rhs_petsc_vec);
     IBTK_CHKERRQ(ierr);
+    if (d_use_sparse_LE_ops)
+    {
+        ierr = VecDestroy(&d_u_LE_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_f_LE_vec);
+        IBTK_CHKERRQ(ierr);
+        d_f_LE_data_synch_sched.setNull();
+        d_f_LE_ghost_fill_sched.setNull();
+    }
 
     // Execute any registered callbacks.
     executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
@@ -1150,6 +1227,31 @@ IBImplicitStaggeredHierarchyIntegrator::IBJacobianSetup_position(SNES /*snes*/,
     CHKERRQ(ierr);
     Vec X = component_sol_vecs[1];
     d_ib_implicit_ops->setLinearizedPosition(X, data_time);
+
+    // Rebuild the sparse Lagrangian-Eulerian coupling operators once per Newton
+    // iteration; they are reused by every subsequent Krylov iteration.
+    if (d_use_sparse_LE_ops)
+    {
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        if (d_jac_delta_fcn == "IB_4")
+        {
+            d_ib_implicit_ops->constructLinearizedLEOperators(
+                ib_4_interp_fcn, ib_4_interp_stencil, d_num_dofs_per_proc[finest_ln], d_u_dof_index_idx, data_time);
+        }
+        else if (d_jac_delta_fcn == "PIECEWISE_LINEAR")
+        {
+            d_ib_implicit_ops->constructLinearizedLEOperators(
+                pwl_interp_fcn, pwl_interp_stencil, d_num_dofs_per_proc[finest_ln], d_u_dof_index_idx, data_time);
+        }
+        else
+        {
+            TBOX_ERROR("IBImplicitStaggeredHierarchyIntegrator::IBJacobianSetup_position()."
+                       << " Delta function "
+                       << d_jac_delta_fcn
+                       << " is not supported in creating sparse coupling operators."
+                       << std::endl);
+        }
+    }
     return ierr;
 } // IBJacobianSetup_position
 
@@ -1278,11 +1380,7 @@ IBImplicitStaggeredHierarchyIntegrator::IBJacobianApply_position(Vec x, Vec f)
         plog << d_object_name << "::integrateHierarchy_position(): spreading Lagrangian force to the Eulerian grid\n";
         plog << "Spreading being done from " << d_object_name << "::IBJacobianApply_position().\n";
     }
-    d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0, /*interior_only*/ false);
-    d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
-    d_u_phys_bdry_op->setHomogeneousBc(true); // use homogeneous BCs to define spreading at physical boundaries
-    d_ib_implicit_ops->spreadLinearizedForce(
-        d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), force_time);
+    spreadLinearizedForce(force_time);
     d_hier_velocity_data_ops->subtract(f_u_idx, f_u_idx, d_f_idx);
 
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(component_sol_vecs[0], &u);
@@ -1304,12 +1402,7 @@ IBImplicitStaggeredHierarchyIntegrator::IBJacobianApply_position(Vec x, Vec f)
     default:
         TBOX_ERROR("unsupported time stepping type\n");
     }
-    d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
-    d_u_phys_bdry_op->setHomogeneousBc(true);
-    d_ib_implicit_ops->interpolateLinearizedVelocity(d_u_idx,
-                                                     getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
-                                                     getGhostfillRefineSchedules(d_object_name + "::u"),
-                                                     velocity_time);
+    interpolateLinearizedVelocity(/*homogeneous_bc*/ true, velocity_time);
     d_ib_implicit_ops->computeLinearizedResidual(X, R);
     return ierr;
 } // IBJacobianApply_position
@@ -1484,12 +1577,7 @@ IBImplicitStaggeredHierarchyIntegrator::IBPCApply_position(Vec x, Vec y)
 
     // Step 2: lag_y := lag_x + dt*J*eul_y/2
     d_hier_velocity_data_ops->scale(d_u_idx, -0.5, eul_y->getComponentDescriptorIndex(0));
-    d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
-    d_u_phys_bdry_op->setHomogeneousBc(true);
-    d_ib_implicit_ops->interpolateLinearizedVelocity(d_u_idx,
-                                                     getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
-                                                     getGhostfillRefineSchedules(d_object_name + "::u"),
-                                                     half_time);
+    interpolateLinearizedVelocity(/*homogeneous_bc*/ true, half_time);
     d_ib_implicit_ops->computeLinearizedResidual(lag_x, lag_y);
 
     // Step 3: lag_y := inv(Sc)*lag_y
@@ -1500,11 +1588,7 @@ IBImplicitStaggeredHierarchyIntegrator::IBPCApply_position(Vec x, Vec y)
     d_ib_implicit_ops->computeLinearizedLagrangianForce(lag_y, half_time);
     ierr = VecScale(lag_y, 0.5);
     CHKERRQ(ierr);
-    d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0, /*interior_only*/ false);
-    d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
-    d_u_phys_bdry_op->setHomogeneousBc(true); // use homogeneous BCs to define spreading at physical boundaries
-    d_ib_implicit_ops->spreadLinearizedForce(
-        d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
+    spreadLinearizedForce(half_time);
     d_u_scratch_vec->setToScalar(0.0);
     d_f_scratch_vec->setToScalar(0.0);
     d_hier_velocity_data_ops->copyData(d_f_scratch_vec->getComponentDescriptorIndex(0), d_f_idx);
@@ -1554,26 +1638,68 @@ IBImplicitStaggeredHierarchyIntegrator::lagrangianSchurApply(Vec X, Vec Y)
 
     // The Schur complement is: I-dt*J*inv(L)*S*A/4
     d_ib_implicit_ops->computeLinearizedLagrangianForce(X, half_time);
-    d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0, /*interior_only*/ false);
-    d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
-    d_u_phys_bdry_op->setHomogeneousBc(true); // use homogeneous BCs to define spreading at physical boundaries
-    d_ib_implicit_ops->spreadLinearizedForce(
-        d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), half_time);
+    spreadLinearizedForce(half_time);
     d_u_scratch_vec->setToScalar(0.0);
     d_hier_velocity_data_ops->copyData(d_f_scratch_vec->getComponentDescriptorIndex(0), d_f_idx);
     d_stokes_solver->setHomogeneousBc(true);
     d_stokes_solver->solveSystem(*d_u_scratch_vec, *d_f_scratch_vec);
     d_hier_velocity_data_ops->scale(d_u_idx, 0.25, d_u_scratch_vec->getComponentDescriptorIndex(0));
-    d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
-    d_u_phys_bdry_op->setHomogeneousBc(false);
-    d_ib_implicit_ops->interpolateLinearizedVelocity(d_u_idx,
-                                                     getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
-                                                     getGhostfillRefineSchedules(d_object_name + "::u"),
-                                                     half_time);
+    interpolateLinearizedVelocity(/*homogeneous_bc*/ false, half_time);
     d_ib_implicit_ops->computeLinearizedResidual(X, Y);
     return 0;
 } // lagrangianSchurApply
 
+void
+IBImplicitStaggeredHierarchyIntegrator::spreadLinearizedForce(const double data_time)
+{
+    d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0, /*interior_only*/ false);
+    if (d_use_sparse_LE_ops)
+    {
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        d_ib_implicit_ops->spreadLinearizedForce(d_f_LE_vec);
+        PETScVecUtilities::copyFromPatchLevelVec(d_f_LE_vec,
+                                                 d_f_idx,
+                                                 d_u_dof_index_idx,
+                                                 d_hierarchy->getPatchLevel(finest_ln),
+                                                 d_f_LE_data_synch_sched,
+                                                 d_f_LE_ghost_fill_sched);
+    }
+    else
+    {
+        d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+        d_u_phys_bdry_op->setHomogeneousBc(true); // use homogeneous BCs to define spreading at physical boundaries
+        d_ib_implicit_ops->spreadLinearizedForce(
+            d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), data_time);
+    }
+    return;
+} // spreadLinearizedForce
+
+void
+IBImplicitStaggeredHierarchyIntegrator::interpolateLinearizedVelocity(const bool homogeneous_bc, const double data_time)
+{
+    if (d_use_sparse_LE_ops)
+    {
+        // The sparse operators are only used on uniform, fully periodic grids,
+        // so there are no physical or coarse-fine boundary conditions to
+        // impose, and homogeneous_bc has no effect.
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        PETScVecUtilities::copyToPatchLevelVec(
+            d_u_LE_vec, d_u_idx, d_u_dof_index_idx, d_hierarchy->getPatchLevel(finest_ln));
+        d_ib_implicit_ops->interpolateLinearizedVelocity(d_u_LE_vec);
+    }
+    else
+    {
+        d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+        d_u_phys_bdry_op->setHomogeneousBc(homogeneous_bc);
+        d_ib_implicit_ops->interpolateLinearizedVelocity(
+            d_u_idx,
+            getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
+            getGhostfillRefineSchedules(d_object_name + "::u"),
+            data_time);
+    }
+    return;
+} // interpolateLinearizedVelocity
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
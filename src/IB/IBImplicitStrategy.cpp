@@ -32,7 +32,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ostream>
+#include <vector>
+
 #include "ibamr/IBImplicitStrategy.h"
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "petscvec.h"
+#include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -54,6 +60,37 @@ IBImplicitStrategy::~IBImplicitStrategy()
     return;
 } // ~IBImplicitStrategy
 
+void
+IBImplicitStrategy::constructLinearizedLEOperators(void (*)(const double, double*),
+                                                   const int /*stencil_width*/,
+                                                   const std::vector<int>& /*num_dofs_per_proc*/,
+                                                   const int /*dof_index_idx*/,
+                                                   const double /*data_time*/)
+{
+    TBOX_ERROR("IBImplicitStrategy::constructLinearizedLEOperators():\n"
+               << "  sparse Lagrangian-Eulerian coupling operators not implemented for this IBImplicitStrategy."
+               << std::endl);
+    return;
+} // constructLinearizedLEOperators
+
+void
+IBImplicitStrategy::spreadLinearizedForce(Vec& /*f_vec*/)
+{
+    TBOX_ERROR("IBImplicitStrategy::spreadLinearizedForce():\n"
+               << "  sparse Lagrangian-Eulerian coupling operators not implemented for this IBImplicitStrategy."
+               << std::endl);
+    return;
+} // spreadLinearizedForce
+
+void
+IBImplicitStrategy::interpolateLinearizedVelocity(Vec& /*u_vec*/)
+{
+    TBOX_ERROR("IBImplicitStrategy::interpolateLinearizedVelocity():\n"
+               << "  sparse Lagrangian-Eulerian coupling operators not implemented for this IBImplicitStrategy."
+               << std::endl);
+    return;
+} // interpolateLinearizedVelocity
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -144,6 +144,24 @@ IBLagrangianForceStrategy::computeLagrangianForceJacobian(Mat& /*J_mat*/,
     return;
 } // computeLagrangianForceJacobian
 
+void
+IBLagrangianForceStrategy::computeLagrangianForceJacobianAction(Vec /*dF_vec*/,
+                                                                Vec /*dX_vec*/,
+                                                                const double /*X_coef*/,
+                                                                Pointer<LData> /*X_data*/,
+                                                                const double /*U_coef*/,
+                                                                Pointer<LData> /*U_data*/,
+                                                                const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                                const int /*level_number*/,
+                                                                const double /*data_time*/,
+                                                                LDataManager* const /*l_data_manager*/)
+{
+    TBOX_ERROR("IBLagrangianForceStrategy::computeLagrangianForceJacobianAction():\n"
+               << "  matrix-free Jacobian functionality not implemented for this IBLagrangianForceStrategy."
+               << std::endl);
+    return;
+} // computeLagrangianForceJacobianAction
+
 double
 IBLagrangianForceStrategy::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
                                                    Pointer<LData> /*U_data*/,
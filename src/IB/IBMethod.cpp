@@ -75,6 +75,7 @@
 #include "ibamr/IBLagrangianSourceStrategy.h"
 #include "ibamr/IBMethod.h"
 #include "ibamr/IBMethodPostProcessStrategy.h"
+#include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_CHKERRQ.h"
@@ -98,6 +99,8 @@
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 namespace IBTK
@@ -122,6 +125,12 @@ namespace IBAMR
 
 namespace
 {
+// Timers.
+static Timer* t_assemble_force_jacobian;
+static Timer* t_apply_force_jacobian;
+static Timer* t_construct_linearized_LE_operators;
+static Timer* t_apply_linearized_LE_operators;
+
 inline double
 cos_kernel(const double x, const double eps)
 {
@@ -169,6 +178,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
+    d_force_jac_matrix_free = false;
     d_do_log = false;
 
     // Initialize object with data read from the input and restart databases.
@@ -217,8 +227,20 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_F_new_needs_ghost_fill = true;
     d_F_half_needs_ghost_fill = true;
 
-    // Indicate that the Jacobian matrix has not been allocated.
+    // Indicate that the Jacobian matrix and the sparse coupling operators have
+    // not been allocated.
     d_force_jac = NULL;
+    d_J_LE_mat = NULL;
+    d_S_LE_mat = NULL;
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(
+        t_assemble_force_jacobian = TimerManager::getManager()->getTimer("IBAMR::IBMethod::assembleForceJacobian()");
+        t_apply_force_jacobian = TimerManager::getManager()->getTimer("IBAMR::IBMethod::applyForceJacobian()");
+        t_construct_linearized_LE_operators =
+            TimerManager::getManager()->getTimer("IBAMR::IBMethod::constructLinearizedLEOperators()");
+        t_apply_linearized_LE_operators =
+            TimerManager::getManager()->getTimer("IBAMR::IBMethod::applyLinearizedLEOperators()"););
     return;
 } // IBMethod
 
@@ -229,12 +251,22 @@ IBMethod::~IBMethod()
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
         d_registered_for_restart = false;
     }
+    PetscErrorCode ierr;
     if (d_force_jac)
     {
-        PetscErrorCode ierr;
         ierr = MatDestroy(&d_force_jac);
         IBTK_CHKERRQ(ierr);
     }
+    if (d_J_LE_mat)
+    {
+        ierr = MatDestroy(&d_J_LE_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_S_LE_mat)
+    {
+        ierr = MatDestroy(&d_S_LE_mat);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~IBMethod
 
@@ -596,8 +628,19 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
         ierr = MatAssemblyEnd(d_force_jac, MAT_FINAL_ASSEMBLY);
         IBTK_CHKERRQ(ierr);
     }
+    else if (d_force_jac_matrix_free)
+    {
+        ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, n_global, n_global, this, &d_force_jac);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatShellSetOperation(
+            d_force_jac, MATOP_MULT, reinterpret_cast<void (*)(void)>(IBMethod::applyForceJacobian_SAMRAI));
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetBlockSize(d_force_jac, NDIM);
+        IBTK_CHKERRQ(ierr);
+    }
     else
     {
+        IBAMR_TIMER_START(t_assemble_force_jacobian);
         std::vector<int> d_nnz, o_nnz;
         d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
             d_nnz, o_nnz, d_hierarchy, level_num, d_l_data_manager);
@@ -633,6 +676,7 @@ IBMethod::setLinearizedPosition(Vec& X_vec, const double data_time)
                                                        level_num,
                                                        data_time,
                                                        d_l_data_manager);
+        IBAMR_TIMER_STOP(t_assemble_force_jacobian);
     }
     return;
 } // setLinearizedPosition
@@ -876,8 +920,10 @@ IBMethod::computeLinearizedLagrangianForce(Vec& X_vec, const double /*data_time*
     bool* F_jac_needs_ghost_fill;
     getLinearizedForceData(&F_jac_data, &F_jac_needs_ghost_fill);
     Vec F_vec = (*F_jac_data)[level_num]->getVec();
+    IBAMR_TIMER_START(t_apply_force_jacobian);
     ierr = MatMult(d_force_jac, X_vec, F_vec);
     IBTK_CHKERRQ(ierr);
+    IBAMR_TIMER_STOP(t_apply_force_jacobian);
     *F_jac_needs_ghost_fill = true;
     IBTK_CHKERRQ(ierr);
     return;
@@ -913,6 +959,8 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
 
         TBOX_ASSERT(d_ib_force_fcn);
 
+        IBAMR_TIMER_START(t_assemble_force_jacobian);
+
         // Build the Jacobian matrix.
         const int num_local_nodes = d_l_data_manager->getNumberOfLocalNodes(finest_ln);
         std::vector<int> d_nnz, o_nnz;
@@ -987,6 +1035,8 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
                                                        finest_ln,
                                                        data_time,
                                                        d_l_data_manager);
+
+        IBAMR_TIMER_STOP(t_assemble_force_jacobian);
     }
     return;
 } // getLagrangianForceJacobian
@@ -1074,6 +1124,82 @@ IBMethod::constructInterpOp(Mat& J,
 
 } // getInterpOperator
 
+void
+IBMethod::constructLinearizedLEOperators(void (*spread_fnc)(const double, double*),
+                                         const int stencil_width,
+                                         const std::vector<int>& num_dofs_per_proc,
+                                         const int dof_index_idx,
+                                         const double data_time)
+{
+    IBAMR_TIMER_START(t_construct_linearized_LE_operators);
+    PetscErrorCode ierr;
+
+    // Build the interpolation operator J for the "frozen" structure
+    // configuration.
+    constructInterpOp(d_J_LE_mat, spread_fnc, stencil_width, num_dofs_per_proc, dof_index_idx, data_time);
+
+    // The spreading operator is S = J^T/dV.  Storing S explicitly (rather than
+    // applying J^T) allows both directions to use the row-oriented CSR
+    // matrix-vector product.  The nonzero structure changes whenever the
+    // structure moves, so S is rebuilt from scratch.
+    if (d_S_LE_mat)
+    {
+        ierr = MatDestroy(&d_S_LE_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = MatTranspose(d_J_LE_mat, MAT_INITIAL_MATRIX, &d_S_LE_mat);
+    IBTK_CHKERRQ(ierr);
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx0 = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(finest_ln)->getRatio();
+    double spread_scale = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) spread_scale *= static_cast<double>(ratio(d)) / dx0[d];
+    ierr = MatScale(d_S_LE_mat, spread_scale);
+    IBTK_CHKERRQ(ierr);
+    IBAMR_TIMER_STOP(t_construct_linearized_LE_operators);
+    return;
+} // constructLinearizedLEOperators
+
+void
+IBMethod::spreadLinearizedForce(Vec& f_vec)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_S_LE_mat);
+#endif
+    IBAMR_TIMER_START(t_apply_linearized_LE_operators);
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    std::vector<Pointer<LData> >* F_jac_data;
+    bool* F_jac_needs_ghost_fill;
+    getLinearizedForceData(&F_jac_data, &F_jac_needs_ghost_fill);
+    resetAnchorPointValues(*F_jac_data,
+                           /*coarsest_ln*/ 0,
+                           /*finest_ln*/ finest_ln);
+    PetscErrorCode ierr = MatMult(d_S_LE_mat, (*F_jac_data)[finest_ln]->getVec(), f_vec);
+    IBTK_CHKERRQ(ierr);
+    IBAMR_TIMER_STOP(t_apply_linearized_LE_operators);
+    return;
+} // spreadLinearizedForce
+
+void
+IBMethod::interpolateLinearizedVelocity(Vec& u_vec)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_J_LE_mat);
+#endif
+    IBAMR_TIMER_START(t_apply_linearized_LE_operators);
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    std::vector<Pointer<LData> >* U_jac_data;
+    getLinearizedVelocityData(&U_jac_data);
+    PetscErrorCode ierr = MatMult(d_J_LE_mat, u_vec, (*U_jac_data)[finest_ln]->getVec());
+    IBTK_CHKERRQ(ierr);
+    resetAnchorPointValues(*U_jac_data,
+                           /*coarsest_ln*/ 0,
+                           /*finest_ln*/ finest_ln);
+    IBAMR_TIMER_STOP(t_apply_linearized_LE_operators);
+    return;
+} // interpolateLinearizedVelocity
+
 void
 IBMethod::computeLagrangianFluidSource(const double data_time)
 {
@@ -2069,6 +2195,7 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("force_jac_matrix_free")) d_force_jac_matrix_free = db->getBool("force_jac_matrix_free");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
@@ -2178,6 +2305,42 @@ IBMethod::computeForce(Vec X, Vec F)
     return ierr;
 } // computeForce
 
+PetscErrorCode
+IBMethod::applyForceJacobian_SAMRAI(Mat A, Vec X, Vec F)
+{
+    PetscErrorCode ierr;
+    void* ctx;
+    ierr = MatShellGetContext(A, &ctx);
+    CHKERRQ(ierr);
+    IBMethod* ib_method_ops = static_cast<IBMethod*>(ctx);
+    ierr = ib_method_ops->applyForceJacobian(X, F);
+    CHKERRQ(ierr);
+    return ierr;
+} // applyForceJacobian_SAMRAI
+
+PetscErrorCode
+IBMethod::applyForceJacobian(Vec X, Vec F)
+{
+    PetscErrorCode ierr;
+    std::vector<Pointer<LData> >* X_jac_data;
+    bool* X_jac_needs_ghost_fill;
+    getLinearizedPositionData(&X_jac_data, &X_jac_needs_ghost_fill);
+    const int level_num = d_hierarchy->getFinestLevelNumber();
+    ierr = VecSet(F, 0.0);
+    CHKERRQ(ierr);
+    d_ib_force_fcn->computeLagrangianForceJacobianAction(F,
+                                                         X,
+                                                         1.0,
+                                                         (*X_jac_data)[level_num],
+                                                         0.0,
+                                                         Pointer<IBTK::LData>(NULL),
+                                                         d_hierarchy,
+                                                         level_num,
+                                                         d_force_jac_data_time,
+                                                         d_l_data_manager);
+    return ierr;
+} // applyForceJacobian
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
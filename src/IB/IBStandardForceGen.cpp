@@ -52,6 +52,7 @@
 #include "ibamr/IBSpringForceSpec.h"
 #include "ibamr/IBStandardForceGen.h"
 #include "ibamr/IBTargetPointForceSpec.h"
+#include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
@@ -64,6 +65,8 @@
 #include "petscsys.h"
 #include "petscvec.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -74,6 +77,16 @@ namespace IBAMR
 
 namespace
 {
+// Timers.
+static Timer* t_initialize_level_data;
+static Timer* t_compute_lagrangian_force;
+static Timer* t_compute_lagrangian_force_jacobian;
+static Timer* t_compute_lagrangian_force_jacobian_action;
+
+// Number of springs or beams that are processed together by the specialized
+// linear force kernels.
+static const int SIMD_WIDTH = 4;
+
 void
 resetLocalPETScIndices(std::vector<int>& inds, const int global_node_offset, const int num_local_nodes)
 {
@@ -123,6 +136,67 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+// Greedily color the specified items so that no two items of the same color
+// share a node.  Item k touches the nodes node_idxs[j][k]/NDIM.  On return,
+// perm contains the items ordered by color, and the items of color c are
+// [perm[color_offsets[c]],perm[color_offsets[c+1]]).
+void
+computeConflictFreeOrdering(std::vector<int>& perm,
+                            std::vector<int>& color_offsets,
+                            const std::vector<int>& items,
+                            const std::vector<const std::vector<int>*>& node_idxs,
+                            const int num_nodes)
+{
+    perm.clear();
+    perm.reserve(items.size());
+    color_offsets.clear();
+    color_offsets.push_back(0);
+    std::vector<int> uncolored_items(items), deferred_items;
+    std::vector<int> node_color(num_nodes, -1);
+    for (int color = 0; !uncolored_items.empty(); ++color)
+    {
+        deferred_items.clear();
+        for (std::vector<int>::const_iterator cit = uncolored_items.begin(); cit != uncolored_items.end(); ++cit)
+        {
+            const int k = *cit;
+            bool has_conflict = false;
+            for (unsigned int j = 0; j < node_idxs.size() && !has_conflict; ++j)
+            {
+                has_conflict = node_color[(*node_idxs[j])[k] / NDIM] == color;
+            }
+            if (has_conflict)
+            {
+                deferred_items.push_back(k);
+                continue;
+            }
+            for (unsigned int j = 0; j < node_idxs.size(); ++j)
+            {
+                node_color[(*node_idxs[j])[k] / NDIM] = color;
+            }
+            perm.push_back(k);
+        }
+        color_offsets.push_back(static_cast<int>(perm.size()));
+        uncolored_items.swap(deferred_items);
+    }
+    return;
+} // computeConflictFreeOrdering
+
+template <typename T>
+void
+permuteVector(std::vector<T>& v, const std::vector<int>& perm)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(v.size() == perm.size());
+#endif
+    std::vector<T> v_perm(v.size());
+    for (unsigned int k = 0; k < perm.size(); ++k)
+    {
+        v_perm[k] = v[perm[k]];
+    }
+    v.swap(v_perm);
+    return;
+} // permuteVector
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -134,13 +208,26 @@ IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
 
     // Set some default values.
     d_log_target_point_displacements = false;
+    d_use_specialized_linear_force_kernels = true;
 
     // Set up force generator from input.
     if (input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("use_specialized_linear_force_kernels"))
+            d_use_specialized_linear_force_kernels = input_db->getBool("use_specialized_linear_force_kernels");
     }
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_initialize_level_data =
+                      TimerManager::getManager()->getTimer("IBAMR::IBStandardForceGen::initializeLevelData()");
+                  t_compute_lagrangian_force =
+                      TimerManager::getManager()->getTimer("IBAMR::IBStandardForceGen::computeLagrangianForce()");
+                  t_compute_lagrangian_force_jacobian = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBStandardForceGen::computeLagrangianForceJacobian()");
+                  t_compute_lagrangian_force_jacobian_action = TimerManager::getManager()->getTimer(
+                      "IBAMR::IBStandardForceGen::computeLagrangianForceJacobianAction()"););
     return;
 } // IBStandardForceGen
 
@@ -169,6 +256,8 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
 {
     if (!l_data_manager->levelContainsLagrangianData(level_number)) return;
 
+    IBAMR_TIMER_START(t_initialize_level_data);
+
 #if !defined(NDEBUG)
     TBOX_ASSERT(hierarchy);
 #endif
@@ -183,6 +272,7 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     d_target_point_data.resize(new_size);
     d_X_ghost_data.resize(new_size);
     d_F_ghost_data.resize(new_size);
+    d_V_ghost_data.resize(new_size);
     d_dX_data.resize(new_size);
     d_is_initialized.resize(new_size, false);
 
@@ -224,6 +314,10 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     F_name_stream << "IBStandardForceGen::F_ghost_" << level_number;
     d_F_ghost_data[level_number] = new LData(F_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
 
+    std::ostringstream V_name_stream;
+    V_name_stream << "IBStandardForceGen::V_ghost_" << level_number;
+    d_V_ghost_data[level_number] = new LData(V_name_stream.str(), num_local_nodes, NDIM, nonlocal_petsc_idxs);
+
     std::ostringstream dX_name_stream;
     dX_name_stream << "IBStandardForceGen::dX_" << level_number;
     d_dX_data[level_number] = new LData(dX_name_stream.str(), num_local_nodes, NDIM);
@@ -296,8 +390,13 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
                    d_target_point_data[level_number].petsc_global_node_idxs.begin(),
                    std::bind2nd(std::multiplies<int>(), NDIM));
 
+    // Group the springs and beams for the specialized force kernels.
+    initializeSpringAndBeamColoring(level_number, num_local_nodes + static_cast<int>(nonlocal_petsc_idxs.size()));
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
+
+    IBAMR_TIMER_STOP(t_initialize_level_data);
     return;
 } // initializeLevelData
 
@@ -312,6 +411,8 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
 {
     if (!l_data_manager->levelContainsLagrangianData(level_number)) return;
 
+    IBAMR_TIMER_START(t_compute_lagrangian_force);
+
     int ierr;
 
     // Initialize ghost data.
@@ -349,6 +450,9 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
     IBTK_CHKERRQ(ierr);
     ierr = VecAXPY(F_data->getVec(), 1.0, F_ghost_data->getVec());
+    IBTK_CHKERRQ(ierr);
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_force);
     return;
 } // computeLagrangianForce
 
@@ -554,6 +658,8 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
     TBOX_ASSERT(d_is_initialized[level_number]);
 #endif
 
+    IBAMR_TIMER_START(t_compute_lagrangian_force_jacobian);
+
     int ierr;
     Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
     Pointer<LData> dX_data = d_dX_data[level_number];
@@ -739,9 +845,175 @@ IBStandardForceGen::computeLagrangianForceJacobian(Mat& J_mat,
     IBTK_CHKERRQ(ierr);
     ierr = MatAssemblyEnd(J_mat, assembly_type);
     IBTK_CHKERRQ(ierr);
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_force_jacobian);
     return;
 } // computeLagrangianForceJacobian
 
+void
+IBStandardForceGen::computeLagrangianForceJacobianAction(Vec dF_vec,
+                                                         Vec dX_vec,
+                                                         const double X_coef,
+                                                         Pointer<LData> X_data,
+                                                         const double U_coef,
+                                                         Pointer<LData> /*U_data*/,
+                                                         const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                         const int level_number,
+                                                         const double /*data_time*/,
+                                                         LDataManager* const l_data_manager)
+{
+    if (!l_data_manager->levelContainsLagrangianData(level_number)) return;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number < static_cast<int>(d_is_initialized.size()));
+    TBOX_ASSERT(d_is_initialized[level_number]);
+#endif
+
+    IBAMR_TIMER_START(t_compute_lagrangian_force_jacobian_action);
+
+    int ierr;
+
+    // Initialize ghost data.
+    Pointer<LData> F_ghost_data = d_F_ghost_data[level_number];
+    Vec F_ghost_local_form_vec;
+    ierr = VecGhostGetLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecSet(F_ghost_local_form_vec, 0.0);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(F_ghost_data->getVec(), &F_ghost_local_form_vec);
+    IBTK_CHKERRQ(ierr);
+
+    Pointer<LData> X_ghost_data = d_X_ghost_data[level_number];
+    Pointer<LData> dX_data = d_dX_data[level_number];
+    ierr = VecAXPBYPCZ(X_ghost_data->getVec(), 1.0, 1.0, 0.0, X_data->getVec(), dX_data->getVec());
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    Pointer<LData> V_ghost_data = d_V_ghost_data[level_number];
+    ierr = VecCopy(dX_vec, V_ghost_data->getVec());
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateBegin(V_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(V_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    double* const F_node = F_ghost_data->getLocalFormVecArray()->data();
+    const double* const X_node = X_ghost_data->getGhostedLocalFormVecArray()->data();
+    const double* const V_node = V_ghost_data->getGhostedLocalFormVecArray()->data();
+
+    { // Spring forces.
+        const std::vector<int>& lag_mastr_node_idxs = d_spring_data[level_number].lag_mastr_node_idxs;
+        const std::vector<int>& lag_slave_node_idxs = d_spring_data[level_number].lag_slave_node_idxs;
+        const std::vector<int>& petsc_mastr_node_idxs = d_spring_data[level_number].petsc_mastr_node_idxs;
+        const std::vector<int>& petsc_slave_node_idxs = d_spring_data[level_number].petsc_slave_node_idxs;
+        const std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
+        const std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
+        const std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
+        double D[NDIM], dV[NDIM], R, T, dT_dR, eps, D_dot_dV, dF;
+        for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
+        {
+            const int mastr_idx = petsc_mastr_node_idxs[k];
+            const int slave_idx = petsc_slave_node_idxs[k];
+            const int lag_mastr_idx = lag_mastr_node_idxs[k];
+            const int lag_slave_idx = lag_slave_node_idxs[k];
+            const SpringForceFcnPtr force_fcn = force_fcns[k];
+            const SpringForceDerivFcnPtr force_deriv_fcn = force_deriv_fcns[k];
+            const double* const params = parameters[k];
+            R = 0.0;
+            D_dot_dV = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                D[d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+                dV[d] = V_node[slave_idx + d] - V_node[mastr_idx + d];
+                R += D[d] * D[d];
+                D_dot_dV += D[d] * dV[d];
+            }
+            R = sqrt(R);
+            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
+            T = force_fcn(R, params, lag_mastr_idx, lag_slave_idx);
+            if (!force_deriv_fcn)
+            {
+                // Use finite differences to approximate dT/dR.
+                eps = std::max(R, 1.0) * pow(std::numeric_limits<double>::epsilon(), 1.0 / 3.0);
+                dT_dR = (force_fcn(R + eps, params, lag_mastr_idx, lag_slave_idx) -
+                         force_fcn(R - eps, params, lag_mastr_idx, lag_slave_idx)) /
+                        (2.0 * eps);
+            }
+            else
+            {
+                dT_dR = force_deriv_fcn(R, params, lag_mastr_idx, lag_slave_idx);
+            }
+
+            // Apply the same block that computeLagrangianForceJacobian()
+            // accumulates into the matrix:
+            //
+            // dF_k/dx_l = (T/R * I) + (dT/dR - T/R) * (D outer D)/R^2
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                dF = X_coef * ((T / R) * dV[d] + (dT_dR - T / R) * D_dot_dV * D[d] / (R * R));
+                F_node[mastr_idx + d] += dF;
+                F_node[slave_idx + d] -= dF;
+            }
+        }
+    }
+
+    { // Beam forces.
+        const std::vector<int>& petsc_mastr_node_idxs = d_beam_data[level_number].petsc_mastr_node_idxs;
+        const std::vector<int>& petsc_next_node_idxs = d_beam_data[level_number].petsc_next_node_idxs;
+        const std::vector<int>& petsc_prev_node_idxs = d_beam_data[level_number].petsc_prev_node_idxs;
+        const std::vector<const double*>& rigidities = d_beam_data[level_number].rigidities;
+        double dF;
+        for (unsigned int k = 0; k < petsc_mastr_node_idxs.size(); ++k)
+        {
+            const int mastr_idx = petsc_mastr_node_idxs[k];
+            const int next_idx = petsc_next_node_idxs[k];
+            const int prev_idx = petsc_prev_node_idxs[k];
+            const double K = X_coef * (*rigidities[k]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                dF = K * (V_node[next_idx + d] + V_node[prev_idx + d] - 2.0 * V_node[mastr_idx + d]);
+                F_node[mastr_idx + d] += 2.0 * dF;
+                F_node[next_idx + d] -= dF;
+                F_node[prev_idx + d] -= dF;
+            }
+        }
+    }
+
+    { // Target point forces.
+        const std::vector<int>& petsc_node_idxs = d_target_point_data[level_number].petsc_node_idxs;
+        const std::vector<const double*>& kappa = d_target_point_data[level_number].kappa;
+        const std::vector<const double*>& eta = d_target_point_data[level_number].eta;
+        for (unsigned int k = 0; k < petsc_node_idxs.size(); ++k)
+        {
+            const int idx = petsc_node_idxs[k];
+            const double C = -X_coef * (*kappa[k]) - U_coef * (*eta[k]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                F_node[idx + d] += C * V_node[idx + d];
+            }
+        }
+    }
+
+    F_ghost_data->restoreArrays();
+    X_ghost_data->restoreArrays();
+    V_ghost_data->restoreArrays();
+
+    // Add the locally computed Jacobian action to the output vector.
+    ierr = VecGhostUpdateBegin(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(F_ghost_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAXPY(dF_vec, 1.0, F_ghost_data->getVec());
+    IBTK_CHKERRQ(ierr);
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_force_jacobian_action);
+    return;
+} // computeLagrangianForceJacobianAction
+
 double
 IBStandardForceGen::computeLagrangianEnergy(Pointer<LData> /*X_data*/,
                                             Pointer<LData> /*U_data*/,
@@ -871,17 +1143,27 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const double /*data_time*/,
                                                  LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
-    if (num_springs == 0) return;
-    const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[0];
-    const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[0];
-    const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[0];
-    const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[0];
-    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[0];
-    const double** const parameters = &d_spring_data[level_number].parameters[0];
+    const int num_total_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
+    if (num_total_springs == 0) return;
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
+    // Linear springs are stored first and are handled by a specialized kernel.
+    const std::vector<int>& linear_color_offsets = d_spring_data[level_number].linear_color_offsets;
+    const int num_linear_springs = linear_color_offsets.empty() ? 0 : linear_color_offsets.back();
+    computeLinearSpringForce(F_node, X_node, level_number);
+
+    // The remaining springs are handled via the registered force functions.
+    const int num_springs = num_total_springs - num_linear_springs;
+    const int* const lag_mastr_node_idxs = &d_spring_data[level_number].lag_mastr_node_idxs[0] + num_linear_springs;
+    const int* const lag_slave_node_idxs = &d_spring_data[level_number].lag_slave_node_idxs[0] + num_linear_springs;
+    const int* const petsc_mastr_node_idxs =
+        &d_spring_data[level_number].petsc_mastr_node_idxs[0] + num_linear_springs;
+    const int* const petsc_slave_node_idxs =
+        &d_spring_data[level_number].petsc_slave_node_idxs[0] + num_linear_springs;
+    const SpringForceFcnPtr* const force_fcns = &d_spring_data[level_number].force_fcns[0] + num_linear_springs;
+    const double** const parameters = &d_spring_data[level_number].parameters[0] + num_linear_springs;
+
     static const int BLOCKSIZE = 16; // this parameter needs to be tuned
     int k, kblock, kunroll, mastr_idx, slave_idx;
     double F[NDIM], D[NDIM], R, T_over_R;
@@ -1097,16 +1379,24 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
                                                const double /*data_time*/,
                                                LDataManager* const /*l_data_manager*/)
 {
-    const int num_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
-    if (num_beams == 0) return;
-    const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[0];
-    const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[0];
-    const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[0];
-    const double** const rigidities = &d_beam_data[level_number].rigidities[0];
-    const Vector** const curvatures = &d_beam_data[level_number].curvatures[0];
+    const int num_total_beams = static_cast<int>(d_beam_data[level_number].petsc_mastr_node_idxs.size());
+    if (num_total_beams == 0) return;
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
+    // Colored beams are stored first and are handled by a specialized kernel.
+    const std::vector<int>& color_offsets = d_beam_data[level_number].color_offsets;
+    const int num_colored_beams = color_offsets.empty() ? 0 : color_offsets.back();
+    computeLinearBeamForce(F_node, X_node, level_number);
+
+    // Any remaining beams are handled by the general loop.
+    const int num_beams = num_total_beams - num_colored_beams;
+    const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[0] + num_colored_beams;
+    const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[0] + num_colored_beams;
+    const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[0] + num_colored_beams;
+    const double** const rigidities = &d_beam_data[level_number].rigidities[0] + num_colored_beams;
+    const Vector** const curvatures = &d_beam_data[level_number].curvatures[0] + num_colored_beams;
+
     static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
     int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
     double K;
@@ -1201,6 +1491,243 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
     return;
 } // computeLagrangianBeamForce
 
+void
+IBStandardForceGen::initializeSpringAndBeamColoring(const int level_number, const int num_ghosted_nodes)
+{
+    std::vector<int> perm, color_offsets;
+
+    { // Springs.
+        SpringData& spring_data = d_spring_data[level_number];
+        spring_data.linear_color_offsets.clear();
+        const int num_springs = static_cast<int>(spring_data.petsc_mastr_node_idxs.size());
+        if (d_use_specialized_linear_force_kernels && num_springs > 0)
+        {
+            // Split the springs into those that use the default linear spring
+            // force law and those that do not.
+            std::vector<int> linear_springs, other_springs;
+            for (int k = 0; k < num_springs; ++k)
+            {
+                if (spring_data.force_fcns[k] == &default_spring_force && spring_data.parameters[k])
+                {
+                    linear_springs.push_back(k);
+                }
+                else
+                {
+                    other_springs.push_back(k);
+                }
+            }
+
+            // Color the linear springs and put them in front of the others.
+            std::vector<const std::vector<int>*> node_idxs(2);
+            node_idxs[0] = &spring_data.petsc_mastr_node_idxs;
+            node_idxs[1] = &spring_data.petsc_slave_node_idxs;
+            computeConflictFreeOrdering(perm, color_offsets, linear_springs, node_idxs, num_ghosted_nodes);
+            perm.insert(perm.end(), other_springs.begin(), other_springs.end());
+
+            permuteVector(spring_data.lag_mastr_node_idxs, perm);
+            permuteVector(spring_data.lag_slave_node_idxs, perm);
+            permuteVector(spring_data.petsc_mastr_node_idxs, perm);
+            permuteVector(spring_data.petsc_slave_node_idxs, perm);
+            permuteVector(spring_data.petsc_global_mastr_node_idxs, perm);
+            permuteVector(spring_data.petsc_global_slave_node_idxs, perm);
+            permuteVector(spring_data.force_fcns, perm);
+            permuteVector(spring_data.force_deriv_fcns, perm);
+            permuteVector(spring_data.parameters, perm);
+            spring_data.linear_color_offsets = color_offsets;
+        }
+    }
+
+    { // Beams.
+        BeamData& beam_data = d_beam_data[level_number];
+        beam_data.color_offsets.clear();
+        const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+        if (d_use_specialized_linear_force_kernels && num_beams > 0)
+        {
+            std::vector<int> beams(num_beams);
+            for (int k = 0; k < num_beams; ++k) beams[k] = k;
+            std::vector<const std::vector<int>*> node_idxs(3);
+            node_idxs[0] = &beam_data.petsc_mastr_node_idxs;
+            node_idxs[1] = &beam_data.petsc_next_node_idxs;
+            node_idxs[2] = &beam_data.petsc_prev_node_idxs;
+            computeConflictFreeOrdering(perm, color_offsets, beams, node_idxs, num_ghosted_nodes);
+
+            permuteVector(beam_data.petsc_mastr_node_idxs, perm);
+            permuteVector(beam_data.petsc_next_node_idxs, perm);
+            permuteVector(beam_data.petsc_prev_node_idxs, perm);
+            permuteVector(beam_data.petsc_global_mastr_node_idxs, perm);
+            permuteVector(beam_data.petsc_global_next_node_idxs, perm);
+            permuteVector(beam_data.petsc_global_prev_node_idxs, perm);
+            permuteVector(beam_data.rigidities, perm);
+            permuteVector(beam_data.curvatures, perm);
+            beam_data.color_offsets = color_offsets;
+        }
+    }
+    return;
+} // initializeSpringAndBeamColoring
+
+void
+IBStandardForceGen::computeLinearSpringForce(double* const F_node, const double* const X_node, const int level_number)
+{
+    const std::vector<int>& color_offsets = d_spring_data[level_number].linear_color_offsets;
+    if (color_offsets.size() < 2) return;
+    const int* const petsc_mastr_node_idxs = &d_spring_data[level_number].petsc_mastr_node_idxs[0];
+    const int* const petsc_slave_node_idxs = &d_spring_data[level_number].petsc_slave_node_idxs[0];
+    const double** const parameters = &d_spring_data[level_number].parameters[0];
+    static const double eps = std::numeric_limits<double>::epsilon();
+
+    // NOTE: Springs of the same color do not share any nodes, so the groups
+    // within a color may be processed in any order without write conflicts.
+    for (unsigned int c = 0; c + 1 < color_offsets.size(); ++c)
+    {
+        const int color_begin = color_offsets[c];
+        const int color_end = color_offsets[c + 1];
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int group_begin = color_begin; group_begin < color_end; group_begin += SIMD_WIDTH)
+        {
+            const int group_size = std::min(SIMD_WIDTH, color_end - group_begin);
+            double D[NDIM][SIMD_WIDTH], K[SIMD_WIDTH], R0[SIMD_WIDTH], T_over_R[SIMD_WIDTH];
+
+            // Gather the displacements and spring parameters.  Unused lanes
+            // are padded with zero-length springs.
+            for (int l = 0; l < group_size; ++l)
+            {
+                const int k = group_begin + l;
+                const int mastr_idx = petsc_mastr_node_idxs[k];
+                const int slave_idx = petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+                TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    D[d][l] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+                }
+                K[l] = parameters[k][0];
+                R0[l] = parameters[k][1];
+            }
+            for (int l = group_size; l < SIMD_WIDTH; ++l)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    D[d][l] = 0.0;
+                }
+                K[l] = 0.0;
+                R0[l] = 0.0;
+            }
+
+            // Evaluate default_spring_force() for the entire group.
+            for (int l = 0; l < SIMD_WIDTH; ++l)
+            {
+                double R_sq = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    R_sq += D[d][l] * D[d][l];
+                }
+                const double R = sqrt(R_sq);
+                T_over_R[l] = R < eps ? 0.0 : K[l] * (R - R0[l]) / std::max(R, eps);
+            }
+
+            // Scatter the forces to the master and slave nodes.
+            for (int l = 0; l < group_size; ++l)
+            {
+                const int k = group_begin + l;
+                const int mastr_idx = petsc_mastr_node_idxs[k];
+                const int slave_idx = petsc_slave_node_idxs[k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double F = T_over_R[l] * D[d][l];
+                    F_node[mastr_idx + d] += F;
+                    F_node[slave_idx + d] -= F;
+                }
+            }
+        }
+    }
+    return;
+} // computeLinearSpringForce
+
+void
+IBStandardForceGen::computeLinearBeamForce(double* const F_node, const double* const X_node, const int level_number)
+{
+    const std::vector<int>& color_offsets = d_beam_data[level_number].color_offsets;
+    if (color_offsets.size() < 2) return;
+    const int* const petsc_mastr_node_idxs = &d_beam_data[level_number].petsc_mastr_node_idxs[0];
+    const int* const petsc_next_node_idxs = &d_beam_data[level_number].petsc_next_node_idxs[0];
+    const int* const petsc_prev_node_idxs = &d_beam_data[level_number].petsc_prev_node_idxs[0];
+    const double** const rigidities = &d_beam_data[level_number].rigidities[0];
+    const Vector** const curvatures = &d_beam_data[level_number].curvatures[0];
+
+    // NOTE: Beams of the same color do not share any nodes, so the groups
+    // within a color may be processed in any order without write conflicts.
+    for (unsigned int c = 0; c + 1 < color_offsets.size(); ++c)
+    {
+        const int color_begin = color_offsets[c];
+        const int color_end = color_offsets[c + 1];
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int group_begin = color_begin; group_begin < color_end; group_begin += SIMD_WIDTH)
+        {
+            const int group_size = std::min(SIMD_WIDTH, color_end - group_begin);
+            double D2X[NDIM][SIMD_WIDTH], K[SIMD_WIDTH];
+
+            // Gather the discrete second differences and beam parameters.
+            // Unused lanes are padded with zero-rigidity beams.
+            for (int l = 0; l < group_size; ++l)
+            {
+                const int k = group_begin + l;
+                const int mastr_idx = petsc_mastr_node_idxs[k];
+                const int next_idx = petsc_next_node_idxs[k];
+                const int prev_idx = petsc_prev_node_idxs[k];
+#if !defined(NDEBUG)
+                TBOX_ASSERT(mastr_idx != next_idx);
+                TBOX_ASSERT(mastr_idx != prev_idx);
+#endif
+                const double* const D2X0 = curvatures[k]->data();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    D2X[d][l] =
+                        X_node[next_idx + d] + X_node[prev_idx + d] - 2.0 * X_node[mastr_idx + d] - D2X0[d];
+                }
+                K[l] = *rigidities[k];
+            }
+            for (int l = group_size; l < SIMD_WIDTH; ++l)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    D2X[d][l] = 0.0;
+                }
+                K[l] = 0.0;
+            }
+
+            // Evaluate the linear beam force law for the entire group.
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                for (int l = 0; l < SIMD_WIDTH; ++l)
+                {
+                    D2X[d][l] *= K[l];
+                }
+            }
+
+            // Scatter the forces to the master and neighbor nodes.
+            for (int l = 0; l < group_size; ++l)
+            {
+                const int k = group_begin + l;
+                const int mastr_idx = petsc_mastr_node_idxs[k];
+                const int next_idx = petsc_next_node_idxs[k];
+                const int prev_idx = petsc_prev_node_idxs[k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_node[mastr_idx + d] += 2.0 * D2X[d][l];
+                    F_node[next_idx + d] -= D2X[d][l];
+                    F_node[prev_idx + d] -= D2X[d][l];
+                }
+            }
+        }
+    }
+    return;
+} // computeLinearBeamForce
+
 void
 IBStandardForceGen::initializeTargetPointLevelData(std::set<int>& /*nonlocal_petsc_idx_set*/,
                                                    const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
@@ -167,6 +167,23 @@ static const bool CONSISTENT_TYPE_2_BDRY = false;
 
 // Version of AdvDiffHierarchyIntegrator restart file data.
 static const int ADV_DIFF_HIERARCHY_INTEGRATOR_VERSION = 3;
+
+// Reset the hierarchy configuration of a collection of function objects.
+template <class VariableType>
+inline void
+reset_fcn_hierarchy_configuration(const std::map<Pointer<VariableType>, Pointer<CartGridFunction> >& fcn_map,
+                                  Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                  const int coarsest_level,
+                                  const int finest_level)
+{
+    for (typename std::map<Pointer<VariableType>, Pointer<CartGridFunction> >::const_iterator it = fcn_map.begin();
+         it != fcn_map.end();
+         ++it)
+    {
+        if (it->second) it->second->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    }
+    return;
+} // reset_fcn_hierarchy_configuration
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -972,6 +989,12 @@ AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_hier_sc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_sc_data_ops->resetLevels(0, finest_hier_level);
 
+    // Reset any data cached by the function objects.
+    reset_fcn_hierarchy_configuration(d_u_fcn, hierarchy, coarsest_level, finest_level);
+    reset_fcn_hierarchy_configuration(d_F_fcn, hierarchy, coarsest_level, finest_level);
+    reset_fcn_hierarchy_configuration(d_diffusion_coef_fcn, hierarchy, coarsest_level, finest_level);
+    reset_fcn_hierarchy_configuration(d_Q_init, hierarchy, coarsest_level, finest_level);
+
     // Reset the interpolation operators.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     d_hier_bdry_fill_ops.resize(d_Q_var.size());
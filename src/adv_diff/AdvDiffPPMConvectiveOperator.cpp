@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <stddef.h>
 #include <ostream>
 #include <string>
@@ -432,13 +433,15 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
     }
 #endif
 
-    // Allocate scratch data.
+    // Allocate scratch data.  These data are retained until the operator state
+    // is deallocated.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_Q_scratch_idx);
-        level->allocatePatchData(d_q_extrap_idx);
-        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
+        if (!level->checkAllocated(d_Q_scratch_idx)) level->allocatePatchData(d_Q_scratch_idx);
+        if (!level->checkAllocated(d_q_extrap_idx)) level->allocatePatchData(d_q_extrap_idx);
+        if ((d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC) &&
+            !level->checkAllocated(d_q_flux_idx))
             level->allocatePatchData(d_q_flux_idx);
     }
 
@@ -772,16 +775,6 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_Q_scratch_idx);
-        level->deallocatePatchData(d_q_extrap_idx);
-        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
-            level->deallocatePatchData(d_q_flux_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -857,6 +850,18 @@ AdvDiffPPMConvectiveOperator::deallocateOperatorState()
     }
     d_ghostfill_scheds.clear();
 
+    // Deallocate scratch data.
+    const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+    for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_Q_scratch_idx)) level->deallocatePatchData(d_Q_scratch_idx);
+        if (level->checkAllocated(d_q_extrap_idx)) level->deallocatePatchData(d_q_extrap_idx);
+        if ((d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC) &&
+            level->checkAllocated(d_q_flux_idx))
+            level->deallocatePatchData(d_q_flux_idx);
+    }
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -38,6 +38,7 @@
 #include <map>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -45,6 +46,7 @@
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "FaceData.h"
@@ -61,6 +63,7 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -72,9 +75,12 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CCLaplaceOperator.h"
+#include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/MemoryDatabase.h"
@@ -116,7 +122,22 @@ static const int CELLG = 1;
 AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(const std::string& object_name,
                                                                                Pointer<Database> input_db,
                                                                                bool register_for_restart)
-    : AdvDiffHierarchyIntegrator(object_name, input_db, register_for_restart)
+    : AdvDiffHierarchyIntegrator(object_name, input_db, register_for_restart),
+      d_group_helmholtz_solves(false),
+      d_helmholtz_solve_group_names(),
+      d_Q_has_custom_helmholtz_solver(),
+      d_Q_helmholtz_group(),
+      d_helmholtz_groups(),
+      d_helmholtz_group_is_explicit(),
+      d_group_sol_var(),
+      d_group_rhs_var(),
+      d_group_bc_coefs(),
+      d_group_sol_vecs(),
+      d_group_rhs_vecs(),
+      d_group_helmholtz_solvers(),
+      d_group_helmholtz_rhs_ops(),
+      d_group_helmholtz_solvers_need_init(),
+      d_group_helmholtz_rhs_ops_need_init()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -450,10 +471,24 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
                          "CONSERVATIVE_LINEAR_REFINE");
     }
 
+    // Keep track of the quantities whose Helmholtz solvers were provided (or
+    // requested) before the default solvers are allocated.  These quantities
+    // are not grouped, so that per-quantity solver choices are respected.
+    d_Q_has_custom_helmholtz_solver.assign(d_Q_var.size(), false);
+    for (unsigned int l = 0; l < d_Q_var.size() && l < d_helmholtz_solvers.size(); ++l)
+    {
+        d_Q_has_custom_helmholtz_solver[l] = !d_helmholtz_solvers[l].isNull();
+    }
+
     // Perform hierarchy initialization operations common to all implementations
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 
+    // Determine which quantities are advanced using grouped Helmholtz solves.
+    // This must follow the common initialization, which sets up the default
+    // Helmholtz solver types.
+    setupHelmholtzGroups();
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -501,6 +536,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     {
         std::fill(d_helmholtz_solvers_need_init.begin(), d_helmholtz_solvers_need_init.end(), true);
         std::fill(d_helmholtz_rhs_ops_need_init.begin(), d_helmholtz_rhs_ops_need_init.end(), true);
+        std::fill(d_group_helmholtz_solvers_need_init.begin(), d_group_helmholtz_solvers_need_init.end(), true);
+        std::fill(d_group_helmholtz_rhs_ops_need_init.begin(), d_group_helmholtz_rhs_ops_need_init.end(), true);
         d_coarsest_reset_ln = 0;
         d_finest_reset_ln = finest_ln;
     }
@@ -547,104 +584,137 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         }
     }
 
-    // Setup the operators and solvers and compute the right-hand-side terms.
-    unsigned int l = 0;
-    for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
-         ++cit, ++l)
+    // Setup the grouped operators and solvers and compute the grouped
+    // right-hand-side terms.
+    for (unsigned int g = 0; g < d_helmholtz_groups.size(); ++g)
     {
-        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
-        Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
-        Pointer<SideVariable<NDIM, double> > D_var = d_Q_diffusion_coef_variable[Q_var];
-        Pointer<SideVariable<NDIM, double> > D_rhs_var = d_diffusion_coef_rhs_map[D_var];
-        TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
-        const double lambda = d_Q_damping_coef[Q_var];
-        const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
-
-        const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
-        const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
-        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
-        const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
-        const int D_current_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getCurrentContext()) : -1);
-        const int D_scratch_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getScratchContext()) : -1);
-        const int D_rhs_scratch_idx =
-            (D_rhs_var ? var_db->mapVariableAndContextToIndex(D_rhs_var, getScratchContext()) : -1);
-
-        // Setup the problem coefficients for the linear solve for Q(n+1).
-        double K = 0.0;
-        switch (diffusion_time_stepping_type)
+        const std::vector<unsigned int>& group = d_helmholtz_groups[g];
+        Pointer<CellVariable<NDIM, double> > Q0_var = d_Q_var[group[0]];
+        std::vector<int> Q_current_idxs(group.size()), Q_rhs_scratch_idxs(group.size());
+        for (unsigned int k = 0; k < group.size(); ++k)
         {
-        case BACKWARD_EULER:
-            K = 1.0;
-            break;
-        case FORWARD_EULER:
-            K = 0.0;
-            break;
-        case TRAPEZOIDAL_RULE:
-            K = 0.5;
-            break;
-        default:
-            TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
-                                     << "  unsupported diffusion time stepping type: "
-                                     << enum_to_string<TimeSteppingType>(diffusion_time_stepping_type)
-                                     << " \n"
-                                     << "  valid choices are: BACKWARD_EULER, FORWARD_EULER, TRAPEZOIDAL_RULE\n");
-        }
-        PoissonSpecifications solver_spec(d_object_name + "::solver_spec::" + Q_var->getName());
-        PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::" + Q_var->getName());
-        solver_spec.setCConstant(1.0 / dt + K * lambda);
-        rhs_op_spec.setCConstant(1.0 / dt - (1.0 - K) * lambda);
-        if (isDiffusionCoefficientVariable(Q_var))
-        {
-            // set -K*kappa in solver_spec
-            d_hier_sc_data_ops->scale(D_scratch_idx, -K, D_current_idx);
-            solver_spec.setDPatchDataId(D_scratch_idx);
-            // set (1.0-K)*kappa in rhs_op_spec
-            d_hier_sc_data_ops->scale(D_rhs_scratch_idx, (1.0 - K), D_current_idx);
-            rhs_op_spec.setDPatchDataId(D_rhs_scratch_idx);
-        }
-        else
-        {
-            const double kappa = d_Q_diffusion_coef[Q_var];
-            solver_spec.setDConstant(-K * kappa);
-            rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[k]];
+            if (!canGroupHelmholtzSolves(Q0_var, Q_var, !d_helmholtz_group_is_explicit[g]))
+            {
+                TBOX_ERROR(d_object_name << "::preprocessIntegrateHierarchy():\n"
+                                         << "  transported quantities " << Q0_var->getName() << " and "
+                                         << Q_var->getName()
+                                         << " no longer have identical diffusion coefficients, damping\n"
+                                         << "  coefficients, or boundary conditions, but they share a grouped "
+                                            "Helmholtz solver.\n");
+            }
+            Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
+            Q_current_idxs[k] = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
+            Q_rhs_scratch_idxs[k] = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
         }
+        const int group_sol_idx = var_db->mapVariableAndContextToIndex(d_group_sol_var[g], getScratchContext());
+        const int group_rhs_idx = var_db->mapVariableAndContextToIndex(d_group_rhs_var[g], getScratchContext());
+
+        // Setup the problem coefficients for the grouped linear solve.
+        PoissonSpecifications solver_spec(d_object_name + "::solver_spec::" + d_group_sol_var[g]->getName());
+        PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::" + d_group_sol_var[g]->getName());
+        setHelmholtzSpecifications(solver_spec, rhs_op_spec, Q0_var, dt);
 
-        // Initialize the RHS operator and compute the RHS vector.
-        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
+        // Initialize the grouped RHS operator and compute the RHS vectors.
+        Pointer<LaplaceOperator> helmholtz_rhs_op = d_group_helmholtz_rhs_ops[g];
         helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
-        helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
+        helmholtz_rhs_op->setPhysicalBcCoefs(d_group_bc_coefs[g]);
         helmholtz_rhs_op->setHomogeneousBc(false);
         helmholtz_rhs_op->setSolutionTime(current_time);
         helmholtz_rhs_op->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_rhs_ops_need_init[l])
+        if (d_group_helmholtz_rhs_ops_need_init[g])
         {
             if (d_enable_logging)
             {
                 plog << d_object_name << ": "
-                     << "Initializing Helmholtz RHS operator for variable number " << l << "\n";
+                     << "Initializing Helmholtz RHS operator for variable group number " << g << "\n";
             }
-            helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_rhs_ops_need_init[l] = false;
+            helmholtz_rhs_op->initializeOperatorState(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+            d_group_helmholtz_rhs_ops_need_init[g] = false;
         }
-        d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
-        helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
+        copyGroupData(group_sol_idx, Q_current_idxs, /*to_group*/ true);
+        helmholtz_rhs_op->apply(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+        copyGroupData(group_rhs_idx, Q_rhs_scratch_idxs, /*to_group*/ false);
 
-        // Initialize the linear solver.
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+        // Initialize the grouped linear solver.
+        Pointer<PoissonSolver> helmholtz_solver = d_group_helmholtz_solvers[g];
         helmholtz_solver->setPoissonSpecifications(solver_spec);
-        helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
+        helmholtz_solver->setPhysicalBcCoefs(d_group_bc_coefs[g]);
         helmholtz_solver->setHomogeneousBc(false);
         helmholtz_solver->setSolutionTime(new_time);
         helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
+        if (d_group_helmholtz_solvers_need_init[g])
         {
             if (d_enable_logging)
             {
                 plog << d_object_name << ": "
-                     << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                     << "Initializing Helmholtz solvers for variable group number " << g << "\n";
+            }
+            helmholtz_solver->initializeSolverState(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+            d_group_helmholtz_solvers_need_init[g] = false;
+        }
+    }
+
+    // Setup the operators and solvers and compute the right-hand-side terms.
+    unsigned int l = 0;
+    for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
+         ++cit, ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
+        const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
+
+        const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
+        const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+        const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
+
+        // Setup the linear solve for Q(n+1) and compute the RHS vector.
+        // Grouped quantities have been handled above.
+        d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
+        if (d_Q_helmholtz_group[l] < 0)
+        {
+            // Setup the problem coefficients for the linear solve for Q(n+1).
+            PoissonSpecifications solver_spec(d_object_name + "::solver_spec::" + Q_var->getName());
+            PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::" + Q_var->getName());
+            setHelmholtzSpecifications(solver_spec, rhs_op_spec, Q_var, dt);
+
+            // Initialize the RHS operator and compute the RHS vector.
+            Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
+            helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
+            helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_rhs_op->setHomogeneousBc(false);
+            helmholtz_rhs_op->setSolutionTime(current_time);
+            helmholtz_rhs_op->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_rhs_ops_need_init[l])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz RHS operator for variable number " << l << "\n";
+                }
+                helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_rhs_ops_need_init[l] = false;
+            }
+            helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
+
+            // Initialize the linear solver.
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            helmholtz_solver->setPoissonSpecifications(solver_spec);
+            helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_solver->setHomogeneousBc(false);
+            helmholtz_solver->setSolutionTime(new_time);
+            helmholtz_solver->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_solvers_need_init[l])
+            {
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                }
+                helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_solvers_need_init[l] = false;
             }
-            helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_solvers_need_init[l] = false;
         }
 
         // Account for the convective difference term.
@@ -726,6 +796,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
     }
 
     // Perform a single step of fixed point iteration.
+    std::vector<TimeSteppingType> convective_time_stepping_types(d_Q_var.size(), UNKNOWN_TIME_STEPPING_TYPE);
     unsigned int l = 0;
     for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
          ++cit, ++l)
@@ -738,7 +809,6 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
         const int F_scratch_idx =
             d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getScratchContext()) : -1;
-        const int F_new_idx = d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
         const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
 
         // Update the advection velocity.
@@ -853,7 +923,10 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
             d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, 1.0, F_scratch_idx, Q_rhs_scratch_idx);
         }
 
-        // Solve for Q(n+1).
+        // Solve for Q(n+1).  Grouped quantities are solved below, once all of
+        // the right-hand sides in the group have been assembled.
+        convective_time_stepping_types[l] = convective_time_stepping_type;
+        if (d_Q_helmholtz_group[l] >= 0) continue;
         Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
         helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
         d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
@@ -870,22 +943,49 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         }
 
         // Reset the right-hand side vector.
-        if (u_var)
+        resetHelmholtzRHS(Q_var, convective_time_stepping_type);
+    }
+
+    // Perform the grouped solves for Q(n+1).
+    for (unsigned int g = 0; g < d_helmholtz_groups.size(); ++g)
+    {
+        const std::vector<unsigned int>& group = d_helmholtz_groups[g];
+        std::vector<int> Q_scratch_idxs(group.size()), Q_rhs_scratch_idxs(group.size());
+        for (unsigned int k = 0; k < group.size(); ++k)
         {
-            const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
-            if (convective_time_stepping_type == ADAMS_BASHFORTH || convective_time_stepping_type == MIDPOINT_RULE)
-            {
-                d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +1.0, N_scratch_idx, Q_rhs_scratch_idx);
-            }
-            else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
-            {
-                d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +0.5, N_scratch_idx, Q_rhs_scratch_idx);
-            }
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[k]];
+            Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
+            Q_scratch_idxs[k] = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+            Q_rhs_scratch_idxs[k] = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
         }
-        if (d_F_fcn[F_var])
+        const int group_sol_idx = var_db->mapVariableAndContextToIndex(d_group_sol_var[g], getScratchContext());
+        const int group_rhs_idx = var_db->mapVariableAndContextToIndex(d_group_rhs_var[g], getScratchContext());
+        copyGroupData(group_sol_idx, Q_scratch_idxs, /*to_group*/ true);
+        copyGroupData(group_rhs_idx, Q_rhs_scratch_idxs, /*to_group*/ true);
+
+        Pointer<PoissonSolver> helmholtz_solver = d_group_helmholtz_solvers[g];
+        helmholtz_solver->solveSystem(*d_group_sol_vecs[g], *d_group_rhs_vecs[g]);
+        copyGroupData(group_sol_idx, Q_scratch_idxs, /*to_group*/ false);
+        if (d_enable_logging)
+            plog << d_object_name << "::integrateHierarchy(): grouped diffusion solve number of iterations = "
+                 << helmholtz_solver->getNumIterations() << "\n";
+        if (d_enable_logging)
+            plog << d_object_name << "::integrateHierarchy(): grouped diffusion solve residual norm        = "
+                 << helmholtz_solver->getResidualNorm() << "\n";
+        if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
         {
-            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, -1.0, F_scratch_idx, Q_rhs_scratch_idx);
-            d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
+            pout << d_object_name << "::integrateHierarchy():"
+                 << "  WARNING: linear solver iterations == max iterations\n";
+        }
+
+        for (unsigned int k = 0; k < group.size(); ++k)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[k]];
+            const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+            d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idxs[k]);
+
+            // Reset the right-hand side vector.
+            resetHelmholtzRHS(Q_var, convective_time_stepping_types[group[k]]);
         }
     }
 
@@ -960,6 +1060,26 @@ AdvDiffSemiImplicitHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
         d_Q_convective_op_needs_init[Q_var] = true;
     }
     AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(base_hierarchy, coarsest_level, finest_level);
+
+    // Reset the grouped solution and rhs vectors.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int wgt_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    for (unsigned int g = 0; g < d_helmholtz_groups.size(); ++g)
+    {
+        const std::string& sol_name = d_group_sol_var[g]->getName();
+        const int group_sol_idx = var_db->mapVariableAndContextToIndex(d_group_sol_var[g], getScratchContext());
+        d_group_sol_vecs[g] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::sol_vec::" + sol_name, d_hierarchy, 0, finest_hier_level);
+        d_group_sol_vecs[g]->addComponent(d_group_sol_var[g], group_sol_idx, wgt_idx, d_hier_cc_data_ops);
+
+        const std::string& rhs_name = d_group_rhs_var[g]->getName();
+        const int group_rhs_idx = var_db->mapVariableAndContextToIndex(d_group_rhs_var[g], getScratchContext());
+        d_group_rhs_vecs[g] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::rhs_vec::" + rhs_name, d_hierarchy, 0, finest_hier_level);
+        d_group_rhs_vecs[g]->addComponent(d_group_rhs_var[g], group_rhs_idx, wgt_idx, d_hier_cc_data_ops);
+    }
+    std::fill(d_group_helmholtz_solvers_need_init.begin(), d_group_helmholtz_solvers_need_init.end(), true);
+    std::fill(d_group_helmholtz_rhs_ops_need_init.begin(), d_group_helmholtz_rhs_ops_need_init.end(), true);
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -1025,6 +1145,22 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+    if (db->keyExists("group_helmholtz_solves")) d_group_helmholtz_solves = db->getBool("group_helmholtz_solves");
+    if (db->isDatabase("helmholtz_solve_groups"))
+    {
+        Pointer<Database> groups_db = db->getDatabase("helmholtz_solve_groups");
+        Array<std::string> group_keys = groups_db->getAllKeys();
+        d_helmholtz_solve_group_names.resize(group_keys.size());
+        for (int k = 0; k < group_keys.size(); ++k)
+        {
+            Array<std::string> group_names = groups_db->getStringArray(group_keys[k]);
+            d_helmholtz_solve_group_names[k].resize(group_names.size());
+            for (int m = 0; m < group_names.size(); ++m)
+            {
+                d_helmholtz_solve_group_names[k][m] = group_names[m];
+            }
+        }
+    }
     return;
 } // getFromInput
 
@@ -1051,6 +1187,303 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+bool
+AdvDiffSemiImplicitHierarchyIntegrator::canGroupHelmholtzSolves(Pointer<CellVariable<NDIM, double> > Q1_var,
+                                                                Pointer<CellVariable<NDIM, double> > Q2_var,
+                                                                const bool require_identical_bc_coefs) const
+{
+    if (isDiffusionCoefficientVariable(Q1_var) || isDiffusionCoefficientVariable(Q2_var)) return false;
+    if (d_Q_diffusion_time_stepping_type.find(Q1_var)->second !=
+        d_Q_diffusion_time_stepping_type.find(Q2_var)->second)
+        return false;
+    if (!MathUtilities<double>::equalEps(d_Q_diffusion_coef.find(Q1_var)->second,
+                                         d_Q_diffusion_coef.find(Q2_var)->second))
+        return false;
+    if (!MathUtilities<double>::equalEps(d_Q_damping_coef.find(Q1_var)->second,
+                                         d_Q_damping_coef.find(Q2_var)->second))
+        return false;
+    if (!require_identical_bc_coefs) return true;
+    return d_Q_bc_coef.find(Q1_var)->second == d_Q_bc_coef.find(Q2_var)->second;
+} // canGroupHelmholtzSolves
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setupHelmholtzGroups()
+{
+    d_Q_helmholtz_group.assign(d_Q_var.size(), -1);
+    d_helmholtz_groups.clear();
+    d_helmholtz_group_is_explicit.clear();
+    if (!d_group_helmholtz_solves && d_helmholtz_solve_group_names.empty()) return;
+
+    // Quantities with their own Helmholtz solvers are never grouped.
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        if (d_Q_has_custom_helmholtz_solver[l] && d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "not grouping the Helmholtz solve for variable " << d_Q_var[l]->getName()
+                 << " because it uses its own Helmholtz solver\n";
+        }
+    }
+
+    // Set up the groups that are explicitly requested in the input database.
+    // The quantities in these groups need not share boundary condition
+    // objects; each depth of the grouped solve uses the boundary conditions of
+    // the corresponding quantity.
+    for (unsigned int k = 0; k < d_helmholtz_solve_group_names.size(); ++k)
+    {
+        const std::vector<std::string>& group_names = d_helmholtz_solve_group_names[k];
+        std::vector<unsigned int> group;
+        for (unsigned int m = 0; m < group_names.size(); ++m)
+        {
+            unsigned int l = 0;
+            while (l < d_Q_var.size() && d_Q_var[l]->getName() != group_names[m]) ++l;
+            if (l == d_Q_var.size())
+            {
+                TBOX_ERROR(d_object_name << "::setupHelmholtzGroups():\n"
+                                         << "  unknown transported quantity " << group_names[m]
+                                         << " in helmholtz_solve_groups.\n");
+            }
+            if (d_Q_helmholtz_group[l] >= 0 || std::find(group.begin(), group.end(), l) != group.end())
+            {
+                TBOX_ERROR(d_object_name << "::setupHelmholtzGroups():\n"
+                                         << "  transported quantity " << group_names[m]
+                                         << " appears more than once in helmholtz_solve_groups.\n");
+            }
+            if (d_Q_has_custom_helmholtz_solver[l]) continue;
+            if (!group.empty() && !canGroupHelmholtzSolves(d_Q_var[group[0]], d_Q_var[l], false))
+            {
+                TBOX_ERROR(d_object_name << "::setupHelmholtzGroups():\n"
+                                         << "  transported quantities " << d_Q_var[group[0]]->getName() << " and "
+                                         << group_names[m]
+                                         << " do not have identical diffusion coefficients, damping\n"
+                                         << "  coefficients, and diffusion time stepping types, but they are "
+                                            "listed in the same\n"
+                                         << "  entry of helmholtz_solve_groups.\n");
+            }
+            group.push_back(l);
+        }
+        if (group.size() < 2) continue;
+        std::sort(group.begin(), group.end());
+        for (unsigned int m = 0; m < group.size(); ++m)
+        {
+            d_Q_helmholtz_group[group[m]] = static_cast<int>(d_helmholtz_groups.size());
+        }
+        d_helmholtz_groups.push_back(group);
+        d_helmholtz_group_is_explicit.push_back(true);
+    }
+
+    // Collect the remaining quantities that can share a single Helmholtz
+    // solver because they use the same boundary condition objects.
+    for (unsigned int l = 0; d_group_helmholtz_solves && l < d_Q_var.size(); ++l)
+    {
+        if (d_Q_helmholtz_group[l] >= 0 || d_Q_has_custom_helmholtz_solver[l] ||
+            isDiffusionCoefficientVariable(d_Q_var[l]))
+            continue;
+        std::vector<unsigned int> group(1, l);
+        for (unsigned int m = l + 1; m < d_Q_var.size(); ++m)
+        {
+            if (d_Q_helmholtz_group[m] < 0 && !d_Q_has_custom_helmholtz_solver[m] &&
+                canGroupHelmholtzSolves(d_Q_var[l], d_Q_var[m]))
+                group.push_back(m);
+        }
+        if (group.size() < 2) continue;
+        for (unsigned int k = 0; k < group.size(); ++k)
+        {
+            d_Q_helmholtz_group[group[k]] = static_cast<int>(d_helmholtz_groups.size());
+        }
+        d_helmholtz_groups.push_back(group);
+        d_helmholtz_group_is_explicit.push_back(false);
+    }
+
+    // Register the multi-depth group variables and allocate the group
+    // operators and solvers.
+    const unsigned int num_groups = static_cast<unsigned int>(d_helmholtz_groups.size());
+    d_group_sol_var.resize(num_groups);
+    d_group_rhs_var.resize(num_groups);
+    d_group_bc_coefs.resize(num_groups);
+    d_group_sol_vecs.resize(num_groups);
+    d_group_rhs_vecs.resize(num_groups);
+    d_group_helmholtz_solvers.resize(num_groups);
+    d_group_helmholtz_rhs_ops.resize(num_groups);
+    d_group_helmholtz_solvers_need_init.resize(num_groups, true);
+    d_group_helmholtz_rhs_ops_need_init.resize(num_groups, true);
+    const IntVector<NDIM> cell_ghosts = CELLG;
+    for (unsigned int g = 0; g < num_groups; ++g)
+    {
+        const std::vector<unsigned int>& group = d_helmholtz_groups[g];
+        int group_depth = 0;
+        d_group_bc_coefs[g].clear();
+        for (unsigned int k = 0; k < group.size(); ++k)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[group[k]];
+            Pointer<CellDataFactory<NDIM, double> > Q_factory = Q_var->getPatchDataFactory();
+            group_depth += Q_factory->getDefaultDepth();
+            const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
+            d_group_bc_coefs[g].insert(d_group_bc_coefs[g].end(), Q_bc_coef.begin(), Q_bc_coef.end());
+        }
+
+        std::ostringstream name_stream;
+        name_stream << d_object_name << "::helmholtz_group_" << g;
+        const std::string name = name_stream.str();
+
+        d_group_sol_var[g] = new CellVariable<NDIM, double>(name + "::sol", group_depth);
+        int group_sol_scratch_idx;
+        registerVariable(group_sol_scratch_idx, d_group_sol_var[g], cell_ghosts, getScratchContext());
+
+        d_group_rhs_var[g] = new CellVariable<NDIM, double>(name + "::rhs", group_depth);
+        int group_rhs_scratch_idx;
+        registerVariable(group_rhs_scratch_idx, d_group_rhs_var[g], cell_ghosts, getScratchContext());
+
+        d_group_helmholtz_solvers[g] =
+            CCPoissonSolverManager::getManager()->allocateSolver(d_helmholtz_solver_type,
+                                                                 name + "::helmholtz_solver",
+                                                                 d_helmholtz_solver_db,
+                                                                 "adv_diff_",
+                                                                 d_helmholtz_precond_type,
+                                                                 name + "::helmholtz_precond",
+                                                                 d_helmholtz_precond_db,
+                                                                 "adv_diff_pc_");
+        d_group_helmholtz_rhs_ops[g] = new CCLaplaceOperator(name + "::helmholtz_rhs_op", /*homogeneous_bc*/ false);
+        d_group_helmholtz_solvers_need_init[g] = true;
+        d_group_helmholtz_rhs_ops_need_init[g] = true;
+
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "using a grouped Helmholtz solver for variables:";
+            for (unsigned int k = 0; k < group.size(); ++k) plog << " " << d_Q_var[group[k]]->getName();
+            plog << "\n";
+        }
+    }
+    return;
+} // setupHelmholtzGroups
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setHelmholtzSpecifications(PoissonSpecifications& solver_spec,
+                                                                   PoissonSpecifications& rhs_op_spec,
+                                                                   Pointer<CellVariable<NDIM, double> > Q_var,
+                                                                   const double dt)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<SideVariable<NDIM, double> > D_var = d_Q_diffusion_coef_variable[Q_var];
+    Pointer<SideVariable<NDIM, double> > D_rhs_var = d_diffusion_coef_rhs_map[D_var];
+    TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
+    const double lambda = d_Q_damping_coef[Q_var];
+    const int D_current_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getCurrentContext()) : -1);
+    const int D_scratch_idx = (D_var ? var_db->mapVariableAndContextToIndex(D_var, getScratchContext()) : -1);
+    const int D_rhs_scratch_idx =
+        (D_rhs_var ? var_db->mapVariableAndContextToIndex(D_rhs_var, getScratchContext()) : -1);
+
+    double K = 0.0;
+    switch (diffusion_time_stepping_type)
+    {
+    case BACKWARD_EULER:
+        K = 1.0;
+        break;
+    case FORWARD_EULER:
+        K = 0.0;
+        break;
+    case TRAPEZOIDAL_RULE:
+        K = 0.5;
+        break;
+    default:
+        TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
+                                 << "  unsupported diffusion time stepping type: "
+                                 << enum_to_string<TimeSteppingType>(diffusion_time_stepping_type)
+                                 << " \n"
+                                 << "  valid choices are: BACKWARD_EULER, FORWARD_EULER, TRAPEZOIDAL_RULE\n");
+    }
+    solver_spec.setCConstant(1.0 / dt + K * lambda);
+    rhs_op_spec.setCConstant(1.0 / dt - (1.0 - K) * lambda);
+    if (isDiffusionCoefficientVariable(Q_var))
+    {
+        // set -K*kappa in solver_spec
+        d_hier_sc_data_ops->scale(D_scratch_idx, -K, D_current_idx);
+        solver_spec.setDPatchDataId(D_scratch_idx);
+        // set (1.0-K)*kappa in rhs_op_spec
+        d_hier_sc_data_ops->scale(D_rhs_scratch_idx, (1.0 - K), D_current_idx);
+        rhs_op_spec.setDPatchDataId(D_rhs_scratch_idx);
+    }
+    else
+    {
+        const double kappa = d_Q_diffusion_coef[Q_var];
+        solver_spec.setDConstant(-K * kappa);
+        rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
+    }
+    return;
+} // setHelmholtzSpecifications
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::copyGroupData(const int group_data_idx,
+                                                      const std::vector<int>& member_data_idxs,
+                                                      const bool to_group)
+{
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > group_data = patch->getPatchData(group_data_idx);
+            int offset = 0;
+            for (unsigned int k = 0; k < member_data_idxs.size(); ++k)
+            {
+                Pointer<CellData<NDIM, double> > member_data = patch->getPatchData(member_data_idxs[k]);
+                const int member_depth = member_data->getDepth();
+                for (int d = 0; d < member_depth; ++d)
+                {
+                    if (to_group)
+                    {
+                        group_data->copyDepth(offset + d, *member_data, d);
+                    }
+                    else
+                    {
+                        member_data->copyDepth(d, *group_data, offset + d);
+                    }
+                }
+                offset += member_depth;
+            }
+#if !defined(NDEBUG)
+            TBOX_ASSERT(offset == group_data->getDepth());
+#endif
+        }
+    }
+    return;
+} // copyGroupData
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::resetHelmholtzRHS(Pointer<CellVariable<NDIM, double> > Q_var,
+                                                          const TimeSteppingType convective_time_stepping_type)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<CellVariable<NDIM, double> > Q_rhs_var = d_Q_Q_rhs_map[Q_var];
+    const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
+    Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
+    if (u_var)
+    {
+        Pointer<CellVariable<NDIM, double> > N_var = d_Q_N_map[Q_var];
+        const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
+        if (convective_time_stepping_type == ADAMS_BASHFORTH || convective_time_stepping_type == MIDPOINT_RULE)
+        {
+            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +1.0, N_scratch_idx, Q_rhs_scratch_idx);
+        }
+        else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
+        {
+            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +0.5, N_scratch_idx, Q_rhs_scratch_idx);
+        }
+    }
+    Pointer<CellVariable<NDIM, double> > F_var = d_Q_F_map[Q_var];
+    if (d_F_fcn[F_var])
+    {
+        const int F_scratch_idx = var_db->mapVariableAndContextToIndex(F_var, getScratchContext());
+        const int F_new_idx = var_db->mapVariableAndContextToIndex(F_var, getNewContext());
+        d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, -1.0, F_scratch_idx, Q_rhs_scratch_idx);
+        d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
+    }
+    return;
+} // resetHelmholtzRHS
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
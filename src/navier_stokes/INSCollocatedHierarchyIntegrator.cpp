@@ -1675,12 +1675,16 @@ INSCollocatedHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     {
         TBOX_ASSERT(hierarchy->getPatchLevel(ln));
     }
-#else
-    NULL_USE(coarsest_level);
-    NULL_USE(finest_level);
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // Reset any data cached by the function objects.
+    if (d_U_init) d_U_init->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_P_init) d_P_init->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_F_fcn) d_F_fcn->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_Q_fcn) d_Q_fcn->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_rho_fcn) d_rho_fcn->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+
     // Reset the hierarchy operations objects for the new hierarchy configuration.
     d_hier_cc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
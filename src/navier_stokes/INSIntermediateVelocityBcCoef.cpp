@@ -43,6 +43,7 @@
 #include "ibamr/INSIntermediateVelocityBcCoef.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/ExtendedRobinBcCoefStrategy.h"
+#include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
@@ -143,6 +144,18 @@ INSIntermediateVelocityBcCoef::setHomogeneousBc(bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+bool
+INSIntermediateVelocityBcCoef::getBcCoefsAreCacheable() const
+{
+    return RobinPhysBdryPatchStrategy::getBcCoefsAreCacheable(d_bc_coefs[d_comp_idx]);
+} // getBcCoefsAreCacheable
+
+bool
+INSIntermediateVelocityBcCoef::getBcCoefsAreTimeIndependent() const
+{
+    return RobinPhysBdryPatchStrategy::getBcCoefsAreTimeIndependent(d_bc_coefs[d_comp_idx]);
+} // getBcCoefsAreTimeIndependent
+
 void
 INSIntermediateVelocityBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
                                           Pointer<ArrayData<NDIM, double> >& bcoef_data,
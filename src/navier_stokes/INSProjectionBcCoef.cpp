@@ -46,6 +46,7 @@
 #include "ibamr/INSProjectionBcCoef.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/ExtendedRobinBcCoefStrategy.h"
+#include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
@@ -145,6 +146,22 @@ INSProjectionBcCoef::setHomogeneousBc(bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+bool
+INSProjectionBcCoef::getBcCoefsAreCacheable() const
+{
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (!RobinPhysBdryPatchStrategy::getBcCoefsAreTimeIndependent(d_bc_coefs[d])) return false;
+    }
+    return true;
+} // getBcCoefsAreCacheable
+
+bool
+INSProjectionBcCoef::getBcCoefsAreTimeIndependent() const
+{
+    return getBcCoefsAreCacheable();
+} // getBcCoefsAreTimeIndependent
+
 void
 INSProjectionBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
                                 Pointer<ArrayData<NDIM, double> >& bcoef_data,
@@ -1425,21 +1425,21 @@ INSStaggeredHierarchyIntegrator::regridHierarchy()
     const int coarsest_ln = 0;
 
     // Determine the divergence of the velocity field before regridding.
-    d_hier_math_ops->div(d_Div_U_idx,
-                         d_Div_U_var,
-                         1.0,
-                         d_U_current_idx,
-                         d_U_var,
-                         d_no_fill_op,
-                         d_integrator_time,
-                         /*synch_cf_bdry*/ false,
-                         -1.0,
-                         d_Q_current_idx,
-                         d_Q_var);
-    const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
-    const double Div_U_norm_1_pre = d_hier_cc_data_ops->L1Norm(d_Div_U_idx, wgt_cc_idx);
-    const double Div_U_norm_2_pre = d_hier_cc_data_ops->L2Norm(d_Div_U_idx, wgt_cc_idx);
-    const double Div_U_norm_oo_pre = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
+    double Div_U_norm_1_pre, Div_U_norm_2_pre, Div_U_norm_oo_pre;
+    d_hier_math_ops->divWithNorms(d_Div_U_idx,
+                                  d_Div_U_var,
+                                  1.0,
+                                  d_U_current_idx,
+                                  d_U_var,
+                                  d_no_fill_op,
+                                  d_integrator_time,
+                                  /*synch_cf_bdry*/ false,
+                                  Div_U_norm_1_pre,
+                                  Div_U_norm_2_pre,
+                                  Div_U_norm_oo_pre,
+                                  -1.0,
+                                  d_Q_current_idx,
+                                  d_Q_var);
 
     // Regrid the hierarchy.
     switch (d_regrid_mode)
@@ -1462,20 +1462,21 @@ INSStaggeredHierarchyIntegrator::regridHierarchy()
     }
 
     // Determine the divergence of the velocity field after regridding.
-    d_hier_math_ops->div(d_Div_U_idx,
-                         d_Div_U_var,
-                         1.0,
-                         d_U_current_idx,
-                         d_U_var,
-                         d_no_fill_op,
-                         d_integrator_time,
-                         /*synch_cf_bdry*/ true,
-                         -1.0,
-                         d_Q_current_idx,
-                         d_Q_var);
-    const double Div_U_norm_1_post = d_hier_cc_data_ops->L1Norm(d_Div_U_idx, wgt_cc_idx);
-    const double Div_U_norm_2_post = d_hier_cc_data_ops->L2Norm(d_Div_U_idx, wgt_cc_idx);
-    const double Div_U_norm_oo_post = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
+    double Div_U_norm_1_post, Div_U_norm_2_post, Div_U_norm_oo_post;
+    d_hier_math_ops->divWithNorms(d_Div_U_idx,
+                                  d_Div_U_var,
+                                  1.0,
+                                  d_U_current_idx,
+                                  d_U_var,
+                                  d_no_fill_op,
+                                  d_integrator_time,
+                                  /*synch_cf_bdry*/ true,
+                                  Div_U_norm_1_post,
+                                  Div_U_norm_2_post,
+                                  Div_U_norm_oo_post,
+                                  -1.0,
+                                  d_Q_current_idx,
+                                  d_Q_var);
 
     // Project the interpolated velocity if needed.
     if (Div_U_norm_1_post > d_regrid_max_div_growth_factor * Div_U_norm_1_pre ||
@@ -1893,12 +1894,16 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     {
         TBOX_ASSERT(hierarchy->getPatchLevel(ln));
     }
-#else
-    NULL_USE(coarsest_level);
-    NULL_USE(finest_level);
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // Reset any data cached by the function objects.
+    if (d_U_init) d_U_init->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_P_init) d_P_init->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_F_fcn) d_F_fcn->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_Q_fcn) d_Q_fcn->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+    if (d_rho_fcn) d_rho_fcn->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+
     // Reset the hierarchy operations objects for the new hierarchy configuration.
     d_hier_cc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <stddef.h>
 #include <ostream>
 #include <string>
@@ -92,6 +93,8 @@ class RobinBcCoefStrategy;
 #define ADVECT_DERIVATIVE_FC IBAMR_FC_FUNC_(advect_derivative3d, ADVECT_DERIVATIVE3D)
 #define CONVECT_DERIVATIVE_FC IBAMR_FC_FUNC_(convect_derivative3d, CONVECT_DERIVATIVE3D)
 #define GODUNOV_EXTRAPOLATE_FC IBAMR_FC_FUNC_(godunov_extrapolate3d, GODUNOV_EXTRAPOLATE3D)
+#define NAVIER_STOKES_FUSED_CONVECTIVE_DERIVATIVE_FC                                                                   \
+    IBAMR_FC_FUNC_(navier_stokes_fused_convective_derivative3d, NAVIER_STOKES_FUSED_CONVECTIVE_DERIVATIVE3D)
 #define NAVIER_STOKES_INTERP_COMPS_FC IBAMR_FC_FUNC_(navier_stokes_interp_comps3d, NAVIER_STOKES_INTERP_COMPS3D)
 #define NAVIER_STOKES_RESET_ADV_VELOCITY_FC                                                                            \
     IBAMR_FC_FUNC_(navier_stokes_reset_adv_velocity3d, NAVIER_STOKES_RESET_ADV_VELOCITY3D)
@@ -441,6 +444,57 @@ void SKEW_SYM_DERIVATIVE_FC(const double*,
                             const int&,
 #endif
                             double*);
+
+#if (NDIM == 3)
+void NAVIER_STOKES_FUSED_CONVECTIVE_DERIVATIVE_FC(
+    const double*,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const double*,
+    const double*,
+    const double*,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const double*,
+    const double*,
+    const double*,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const int&,
+    const double*,
+    const double*,
+    const double*,
+    const int&,
+    const int&,
+    const int&,
+    double*,
+    double*,
+    double*);
+#endif
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -474,6 +528,8 @@ INSStaggeredPPMConvectiveOperator::INSStaggeredPPMConvectiveOperator(
     : ConvectiveOperator(object_name, difference_form),
       d_bc_coefs(bc_coefs),
       d_bdry_extrap_type("CONSTANT"),
+      d_use_fused_convective_kernel(false),
+      d_fused_kernel_tile_size(16),
       d_hierarchy(NULL),
       d_coarsest_ln(-1),
       d_finest_ln(-1),
@@ -492,6 +548,10 @@ INSStaggeredPPMConvectiveOperator::INSStaggeredPPMConvectiveOperator(
     if (input_db)
     {
         if (input_db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = input_db->getString("bdry_extrap_type");
+        if (input_db->keyExists("use_fused_convective_kernel"))
+            d_use_fused_convective_kernel = input_db->getBool("use_fused_convective_kernel");
+        if (input_db->keyExists("fused_kernel_tile_size"))
+            input_db->getIntegerArray("fused_kernel_tile_size", &d_fused_kernel_tile_size(0), NDIM);
     }
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -542,11 +602,12 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Allocate scratch data.  These data are retained until the operator state
+    // is deallocated.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
     }
 
     // Fill ghost cell values for all components.
@@ -585,17 +646,15 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+            PatchScratchData& scratch_data = getPatchScratchData(ln, p(), *U_data);
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
             }
+            const boost::array<Pointer<FaceData<NDIM, double> >, NDIM>& U_adv_data = scratch_data.U_adv_data;
+            const boost::array<Pointer<FaceData<NDIM, double> >, NDIM>& U_half_data = scratch_data.U_half_data;
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
                                           patch_upper(0),
@@ -674,17 +733,12 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                const Pointer<SideData<NDIM, double> >& dU_data = scratch_data.dU_data;
+                const Pointer<SideData<NDIM, double> >& U_L_data = scratch_data.U_L_data;
+                const Pointer<SideData<NDIM, double> >& U_R_data = scratch_data.U_R_data;
+                const Pointer<SideData<NDIM, double> >& U_scratch1_data = scratch_data.U_scratch1_data;
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                const Pointer<SideData<NDIM, double> >& U_scratch2_data = scratch_data.U_scratch2_data;
 #endif
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -737,6 +791,81 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                        U_half_data[axis]->getPointer(2));
 #endif
             }
+#if (NDIM == 3)
+            if (d_use_fused_convective_kernel)
+            {
+                // Evaluate all components of N directly from the extrapolated
+                // velocities, bypassing the reset of the advection velocity and
+                // the separate directional sweeps of the unfused kernels.
+                int diff_form = 0;
+                switch (d_difference_form)
+                {
+                case CONSERVATIVE:
+                    diff_form = 0;
+                    break;
+                case ADVECTIVE:
+                    diff_form = 1;
+                    break;
+                case SKEW_SYMMETRIC:
+                    diff_form = 2;
+                    break;
+                default:
+                    TBOX_ERROR("INSStaggeredPPMConvectiveOperator::applyConvectiveOperator():\n"
+                               << "  unsupported differencing form: "
+                               << enum_to_string<ConvectiveDifferencingType>(d_difference_form)
+                               << " \n"
+                               << "  valid choices are: ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC\n");
+                }
+                NAVIER_STOKES_FUSED_CONVECTIVE_DERIVATIVE_FC(dx,
+                                                             diff_form,
+                                                             d_fused_kernel_tile_size(0),
+                                                             d_fused_kernel_tile_size(1),
+                                                             d_fused_kernel_tile_size(2),
+                                                             side_boxes[0].lower(0),
+                                                             side_boxes[0].upper(0),
+                                                             side_boxes[0].lower(1),
+                                                             side_boxes[0].upper(1),
+                                                             side_boxes[0].lower(2),
+                                                             side_boxes[0].upper(2),
+                                                             U_half_data[0]->getGhostCellWidth()(0),
+                                                             U_half_data[0]->getGhostCellWidth()(1),
+                                                             U_half_data[0]->getGhostCellWidth()(2),
+                                                             U_half_data[0]->getPointer(0),
+                                                             U_half_data[0]->getPointer(1),
+                                                             U_half_data[0]->getPointer(2),
+                                                             side_boxes[1].lower(0),
+                                                             side_boxes[1].upper(0),
+                                                             side_boxes[1].lower(1),
+                                                             side_boxes[1].upper(1),
+                                                             side_boxes[1].lower(2),
+                                                             side_boxes[1].upper(2),
+                                                             U_half_data[1]->getGhostCellWidth()(0),
+                                                             U_half_data[1]->getGhostCellWidth()(1),
+                                                             U_half_data[1]->getGhostCellWidth()(2),
+                                                             U_half_data[1]->getPointer(0),
+                                                             U_half_data[1]->getPointer(1),
+                                                             U_half_data[1]->getPointer(2),
+                                                             side_boxes[2].lower(0),
+                                                             side_boxes[2].upper(0),
+                                                             side_boxes[2].lower(1),
+                                                             side_boxes[2].upper(1),
+                                                             side_boxes[2].lower(2),
+                                                             side_boxes[2].upper(2),
+                                                             U_half_data[2]->getGhostCellWidth()(0),
+                                                             U_half_data[2]->getGhostCellWidth()(1),
+                                                             U_half_data[2]->getGhostCellWidth()(2),
+                                                             U_half_data[2]->getPointer(0),
+                                                             U_half_data[2]->getPointer(1),
+                                                             U_half_data[2]->getPointer(2),
+                                                             N_data->getGhostCellWidth()(0),
+                                                             N_data->getGhostCellWidth()(1),
+                                                             N_data->getGhostCellWidth()(2),
+                                                             N_data->getPointer(0),
+                                                             N_data->getPointer(1),
+                                                             N_data->getPointer(2));
+                continue;
+            }
+#endif
 #if (NDIM == 2)
             NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
                                                 side_boxes[0].upper(0),
@@ -969,13 +1098,6 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1016,6 +1138,9 @@ INSStaggeredPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorRea
     d_hier_bdry_fill = new HierarchyGhostCellInterpolation();
     d_hier_bdry_fill->initializeOperatorState(d_transaction_comps, d_hierarchy);
 
+    // Setup the patch-local scratch data, which are allocated as needed.
+    d_patch_scratch_data.resize(d_finest_ln + 1);
+
     // Initialize the BC helper.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
@@ -1037,6 +1162,15 @@ INSStaggeredPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+    for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+    d_patch_scratch_data.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -1047,6 +1181,39 @@ INSStaggeredPPMConvectiveOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+INSStaggeredPPMConvectiveOperator::PatchScratchData&
+INSStaggeredPPMConvectiveOperator::getPatchScratchData(const int ln,
+                                                       const int patch_num,
+                                                       const SideData<NDIM, double>& U_data)
+{
+    std::vector<PatchScratchData>& level_scratch_data = d_patch_scratch_data[ln];
+    if (static_cast<int>(level_scratch_data.size()) <= patch_num) level_scratch_data.resize(patch_num + 1);
+    PatchScratchData& scratch_data = level_scratch_data[patch_num];
+    const Box<NDIM>& patch_box = U_data.getBox();
+    const bool reallocate = !scratch_data.dU_data || !(scratch_data.patch_box == patch_box) ||
+                            scratch_data.dU_data->getGhostCellWidth() != U_data.getGhostCellWidth();
+    if (!reallocate) return scratch_data;
+
+    scratch_data.patch_box = patch_box;
+    const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        scratch_data.U_adv_data[axis] = new FaceData<NDIM, double>(side_box, 1, ghosts);
+        scratch_data.U_half_data[axis] = new FaceData<NDIM, double>(side_box, 1, ghosts);
+    }
+    const int depth = U_data.getDepth();
+    const IntVector<NDIM>& U_ghosts = U_data.getGhostCellWidth();
+    scratch_data.dU_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+    scratch_data.U_L_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+    scratch_data.U_R_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+    scratch_data.U_scratch1_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+#if (NDIM == 3)
+    scratch_data.U_scratch2_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+#endif
+    return scratch_data;
+} // getPatchScratchData
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <stddef.h>
 #include <cmath>
 #include <ostream>
@@ -581,11 +582,12 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
     TBOX_ASSERT(U_idx == d_u_idx);
 #endif
 
-    // Allocate scratch data.
+    // Allocate scratch data.  These data are retained until the operator state
+    // is deallocated.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_U_scratch_idx);
+        if (!level->checkAllocated(d_U_scratch_idx)) level->allocatePatchData(d_U_scratch_idx);
     }
 
     // Fill ghost cell values for all components.
@@ -628,22 +630,19 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             const IntVector<NDIM>& patch_upper = patch_box.upper();
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > N_upwind_data =
-                new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+            PatchScratchData& scratch_data = getPatchScratchData(ln, p(), *U_data, *N_data);
+            const Pointer<SideData<NDIM, double> >& N_upwind_data = scratch_data.N_upwind_data;
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
-            boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_upwind_data;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_upwind_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
             }
+            const boost::array<Pointer<FaceData<NDIM, double> >, NDIM>& U_adv_data = scratch_data.U_adv_data;
+            const boost::array<Pointer<FaceData<NDIM, double> >, NDIM>& U_half_data = scratch_data.U_half_data;
+            const boost::array<Pointer<FaceData<NDIM, double> >, NDIM>& U_half_upwind_data =
+                scratch_data.U_half_upwind_data;
 
 // Interpolate the staggered-grid velocity field onto the faces of
 // the control volumes.
@@ -898,17 +897,12 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             // Compute the xsPPM7 discretization.
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                const Pointer<SideData<NDIM, double> >& dU_data = scratch_data.dU_data;
+                const Pointer<SideData<NDIM, double> >& U_L_data = scratch_data.U_L_data;
+                const Pointer<SideData<NDIM, double> >& U_R_data = scratch_data.U_R_data;
+                const Pointer<SideData<NDIM, double> >& U_scratch1_data = scratch_data.U_scratch1_data;
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                const Pointer<SideData<NDIM, double> >& U_scratch2_data = scratch_data.U_scratch2_data;
 #endif
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -1213,8 +1207,12 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             }
             if (patch_geom->getTouchesRegularBoundary())
             {
-                Pointer<SideData<NDIM, double> > N_PPM_data =
-                    new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+                if (!scratch_data.N_PPM_data)
+                {
+                    scratch_data.N_PPM_data =
+                        new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+                }
+                const Pointer<SideData<NDIM, double> >& N_PPM_data = scratch_data.N_PPM_data;
                 N_PPM_data->copy(*N_data);
                 for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
                 {
@@ -1254,13 +1252,6 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
         }
     }
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_U_scratch_idx);
-    }
-
     IBAMR_TIMER_STOP(t_apply_convective_operator);
     return;
 } // applyConvectiveOperator
@@ -1301,6 +1292,9 @@ INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(const SAMRA
     d_hier_bdry_fill = new HierarchyGhostCellInterpolation();
     d_hier_bdry_fill->initializeOperatorState(d_transaction_comps, d_hierarchy);
 
+    // Setup the patch-local scratch data, which are allocated as needed.
+    d_patch_scratch_data.resize(d_finest_ln + 1);
+
     // Initialize the BC helper.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
@@ -1322,6 +1316,15 @@ INSStaggeredStabilizedPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Deallocate scratch data.
+    const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+    for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_U_scratch_idx)) level->deallocatePatchData(d_U_scratch_idx);
+    }
+    d_patch_scratch_data.clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -1332,6 +1335,45 @@ INSStaggeredStabilizedPPMConvectiveOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+INSStaggeredStabilizedPPMConvectiveOperator::PatchScratchData&
+INSStaggeredStabilizedPPMConvectiveOperator::getPatchScratchData(const int ln,
+                                                                 const int patch_num,
+                                                                 const SideData<NDIM, double>& U_data,
+                                                                 const SideData<NDIM, double>& N_data)
+{
+    std::vector<PatchScratchData>& level_scratch_data = d_patch_scratch_data[ln];
+    if (static_cast<int>(level_scratch_data.size()) <= patch_num) level_scratch_data.resize(patch_num + 1);
+    PatchScratchData& scratch_data = level_scratch_data[patch_num];
+    const Box<NDIM>& patch_box = U_data.getBox();
+    const bool reallocate = !scratch_data.dU_data || !(scratch_data.patch_box == patch_box) ||
+                            scratch_data.dU_data->getGhostCellWidth() != U_data.getGhostCellWidth() ||
+                            scratch_data.N_upwind_data->getGhostCellWidth() != N_data.getGhostCellWidth();
+    if (!reallocate) return scratch_data;
+
+    scratch_data.patch_box = patch_box;
+    const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        scratch_data.U_adv_data[axis] = new FaceData<NDIM, double>(side_box, 1, ghosts);
+        scratch_data.U_half_data[axis] = new FaceData<NDIM, double>(side_box, 1, ghosts);
+        scratch_data.U_half_upwind_data[axis] = new FaceData<NDIM, double>(side_box, 1, ghosts);
+    }
+    const int depth = U_data.getDepth();
+    const IntVector<NDIM>& U_ghosts = U_data.getGhostCellWidth();
+    scratch_data.dU_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+    scratch_data.U_L_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+    scratch_data.U_R_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+    scratch_data.U_scratch1_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+#if (NDIM == 3)
+    scratch_data.U_scratch2_data = new SideData<NDIM, double>(patch_box, depth, U_ghosts);
+#endif
+    scratch_data.N_upwind_data =
+        new SideData<NDIM, double>(N_data.getBox(), N_data.getDepth(), N_data.getGhostCellWidth());
+    scratch_data.N_PPM_data.setNull();
+    return scratch_data;
+} // getPatchScratchData
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -209,6 +209,10 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
         if (input_db->isDatabase("coarse_solver_db")) d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
+        if (input_db->keyExists("num_geometric_coarse_levels"))
+            d_num_geometric_coarse_levels = input_db->getInteger("num_geometric_coarse_levels");
+        if (input_db->keyExists("geometric_coarse_level_min_box_size"))
+            setGeometricCoarseLevelMinBoxSize(input_db->getInteger("geometric_coarse_level_min_box_size"));
     }
 
     // Configure the coarse level solver.
@@ -552,6 +556,15 @@ StaggeredStokesFACPreconditionerStrategy::solveCoarsestLevel(SAMRAIVectorReal<ND
         d_coarse_solver->setComponentsHaveNullspace(d_has_velocity_nullspace, d_has_pressure_nullspace);
         LinearSolver* p_coarse_solver = dynamic_cast<LinearSolver*>(d_coarse_solver.getPointer());
 
+        if (d_geometric_coarse_hierarchy)
+        {
+            // Solve on level 0 and the geometric coarse levels below it.
+            copyToGeometricCoarseLevels(error, residual, coarsest_ln);
+            d_coarse_solver->solveSystem(*d_geometric_coarse_solution, *d_geometric_coarse_rhs);
+            copyFromGeometricCoarseLevels(error, coarsest_ln);
+            return true;
+        }
+
         if (p_coarse_solver)
         {
             bool initial_guess_nonzero = true;
@@ -763,8 +776,32 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
         d_coarse_solver->setRelativeTolerance(d_coarse_solver_rel_residual_tol);
         d_coarse_solver->setHomogeneousBc(true);
         d_coarse_solver->setComponentsHaveNullspace(d_has_velocity_nullspace, d_has_pressure_nullspace);
-        d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
-                                               *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        if (d_coarsest_ln == 0 && d_num_geometric_coarse_levels > 0)
+        {
+            const bool coefs_are_constant =
+                (d_U_problem_coefs.cIsConstant() || d_U_problem_coefs.cIsZero()) && d_U_problem_coefs.dIsConstant();
+            initializeGeometricCoarseLevels(*d_solution,
+                                            *d_rhs,
+                                            d_coarsest_ln,
+                                            d_num_geometric_coarse_levels,
+                                            d_coarse_solver.getPointer(),
+                                            coefs_are_constant);
+        }
+        if (d_geometric_coarse_hierarchy)
+        {
+            // The physical boundary helper caches data for a particular patch
+            // hierarchy, so the auxiliary hierarchy requires its own.
+            Pointer<StaggeredStokesPhysicalBoundaryHelper> coarse_bc_helper =
+                new StaggeredStokesPhysicalBoundaryHelper();
+            coarse_bc_helper->cacheBcCoefData(d_U_bc_coefs, d_solution_time, d_geometric_coarse_hierarchy);
+            d_coarse_solver->setPhysicalBoundaryHelper(coarse_bc_helper);
+            d_coarse_solver->initializeSolverState(*d_geometric_coarse_solution, *d_geometric_coarse_rhs);
+        }
+        else
+        {
+            d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
+                                                   *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        }
     }
 
     // Perform implementation-specific initialization.
@@ -958,6 +995,7 @@ StaggeredStokesFACPreconditionerStrategy::deallocateOperatorState()
         d_level_math_ops.clear();
 
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
+        deallocateGeometricCoarseLevels();
 
         d_U_prolongation_refine_operator.setNull();
         d_P_prolongation_refine_operator.setNull();
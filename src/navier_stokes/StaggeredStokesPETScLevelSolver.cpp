@@ -58,7 +58,9 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/PETScLevelSolver.h"
 #include "ibtk/PoissonUtilities.h"
+#include "petscksp.h"
 #include "petscmat.h"
+#include "petscpc.h"
 #include "petscsys.h"
 #include "petscvec.h"
 #include "tbox/Database.h"
@@ -94,11 +96,25 @@ StaggeredStokesPETScLevelSolver::StaggeredStokesPETScLevelSolver(const std::stri
       d_p_dof_index_var(NULL),
       d_p_nullspace_var(NULL),
       d_data_synch_sched(NULL),
-      d_ghost_fill_sched(NULL)
+      d_ghost_fill_sched(NULL),
+      d_amg_type("")
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
     PETScLevelSolver::init(input_db, default_options_prefix);
 
+    // Setup the algebraic multigrid field split preconditioner (if requested).
+    if (input_db && input_db->keyExists("amg_type")) d_amg_type = input_db->getString("amg_type");
+    if (d_amg_type != "")
+    {
+        if (d_amg_type != "gamg" && d_amg_type != "boomeramg")
+        {
+            TBOX_ERROR(d_object_name << "::StaggeredStokesPETScLevelSolver()\n"
+                                     << "  unknown amg_type: " << d_amg_type << "\n"
+                                     << "  valid choices are: gamg, boomeramg" << std::endl);
+        }
+        d_pc_type = "fieldsplit";
+    }
+
     // Construct the DOF index variable/context.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     d_context = var_db->getContext(object_name + "::CONTEXT");
@@ -148,6 +164,15 @@ StaggeredStokesPETScLevelSolver::~StaggeredStokesPETScLevelSolver()
     return;
 } // ~StaggeredStokesPETScLevelSolver
 
+void
+StaggeredStokesPETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                       const SAMRAIVectorReal<NDIM, double>& b)
+{
+    PETScLevelSolver::initializeSolverState(x, b);
+    if (d_amg_type != "") setupAMGFieldSplitPreconditioner();
+    return;
+} // initializeSolverState
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -203,7 +228,8 @@ StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVe
                                                                          d_num_dofs_per_proc,
                                                                          d_u_dof_index_idx,
                                                                          d_p_dof_index_idx,
-                                                                         d_level);
+                                                                         d_level,
+                                                                         d_reuse_operator_structure);
     d_petsc_pc = d_petsc_mat;
 
 
@@ -350,6 +376,74 @@ StaggeredStokesPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+StaggeredStokesPETScLevelSolver::setupAMGFieldSplitPreconditioner()
+{
+    if (d_pc_type != "fieldsplit")
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  amg_type = " << d_amg_type << " requires pc_type = fieldsplit, but pc_type = "
+                                 << d_pc_type << std::endl);
+    }
+
+    // By default, use an upper block-triangular Schur-complement factorization
+    // with the "selfp" approximation to the pressure Schur complement, which is
+    // assembled and therefore amenable to algebraic multigrid.  (Command-line
+    // options always take precedence.)
+    int ierr;
+    PC ksp_pc;
+    ierr = KSPGetPC(d_petsc_ksp, &ksp_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCFieldSplitSetType(ksp_pc, PC_COMPOSITE_SCHUR);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCFieldSplitSetSchurFactType(ksp_pc, PC_FIELDSPLIT_SCHUR_FACT_UPPER);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCFieldSplitSetSchurPre(ksp_pc, PC_FIELDSPLIT_SCHUR_PRE_SELFP, NULL);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetFromOptions(ksp_pc);
+    IBTK_CHKERRQ(ierr);
+
+    // The sub-solvers are only available once the field split preconditioner
+    // has been set up.
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    PetscInt n_splits;
+    KSP* sub_ksp;
+    ierr = PCFieldSplitGetSubKSP(ksp_pc, &n_splits, &sub_ksp);
+    IBTK_CHKERRQ(ierr);
+    for (int k = 0; k < n_splits; ++k)
+    {
+        ierr = KSPSetType(sub_ksp[k], KSPPREONLY);
+        IBTK_CHKERRQ(ierr);
+        PC sub_pc;
+        ierr = KSPGetPC(sub_ksp[k], &sub_pc);
+        IBTK_CHKERRQ(ierr);
+        if (d_amg_type == "gamg")
+        {
+            ierr = PCSetType(sub_pc, PCGAMG);
+            IBTK_CHKERRQ(ierr);
+        }
+        else if (d_amg_type == "boomeramg")
+        {
+#if defined(PETSC_HAVE_HYPRE)
+            ierr = PCSetType(sub_pc, PCHYPRE);
+            IBTK_CHKERRQ(ierr);
+            ierr = PCHYPRESetType(sub_pc, "boomeramg");
+            IBTK_CHKERRQ(ierr);
+#else
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  amg_type = boomeramg requires PETSc to be configured with hypre"
+                                     << std::endl);
+#endif
+        }
+        ierr = KSPSetFromOptions(sub_ksp[k]);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = PetscFree(sub_ksp);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // setupAMGFieldSplitPreconditioner
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
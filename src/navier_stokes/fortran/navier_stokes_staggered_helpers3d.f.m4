@@ -724,3 +724,247 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the convective derivative of a staggered velocity field
+c     directly from the face-centered Godunov-extrapolated velocities.
+c
+c     This fuses the operations performed by
+c     navier_stokes_reset_adv_velocity3d and by convect_derivative3d,
+c     advect_derivative3d, or skew_sym_derivative3d: the advection
+c     velocity is read directly from the transverse components of
+c     U_half, and all three directional differences are accumulated in a
+c     single tiled pass over each component of N.
+c
+c     The differencing form is specified by diff_form:
+c
+c        diff_form = 0: N = div[q*u_ADV]
+c        diff_form = 1: N = u_ADV*grad(q)
+c        diff_form = 2: N = 0.5([u_ADV*grad(q)] + div[q*u_ADV])
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_fused_convective_derivative3d(
+     &     dx,diff_form,
+     &     tile0,tile1,tile2,
+     &     side0_ifirst0,side0_ilast0,
+     &     side0_ifirst1,side0_ilast1,
+     &     side0_ifirst2,side0_ilast2,
+     &     n_U_half0_gc0,n_U_half0_gc1,n_U_half0_gc2,
+     &     U_half00,U_half01,U_half02,
+     &     side1_ifirst0,side1_ilast0,
+     &     side1_ifirst1,side1_ilast1,
+     &     side1_ifirst2,side1_ilast2,
+     &     n_U_half1_gc0,n_U_half1_gc1,n_U_half1_gc2,
+     &     U_half10,U_half11,U_half12,
+     &     side2_ifirst0,side2_ilast0,
+     &     side2_ifirst1,side2_ilast1,
+     &     side2_ifirst2,side2_ilast2,
+     &     n_U_half2_gc0,n_U_half2_gc1,n_U_half2_gc2,
+     &     U_half20,U_half21,U_half22,
+     &     n_N_gc0,n_N_gc1,n_N_gc2,
+     &     N0,N1,N2)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER diff_form
+      INTEGER tile0,tile1,tile2
+
+      INTEGER side0_ifirst0,side0_ilast0
+      INTEGER side0_ifirst1,side0_ilast1
+      INTEGER side0_ifirst2,side0_ilast2
+
+      INTEGER n_U_half0_gc0,n_U_half0_gc1,n_U_half0_gc2
+
+      INTEGER side1_ifirst0,side1_ilast0
+      INTEGER side1_ifirst1,side1_ilast1
+      INTEGER side1_ifirst2,side1_ilast2
+
+      INTEGER n_U_half1_gc0,n_U_half1_gc1,n_U_half1_gc2
+
+      INTEGER side2_ifirst0,side2_ilast0
+      INTEGER side2_ifirst1,side2_ilast1
+      INTEGER side2_ifirst2,side2_ilast2
+
+      INTEGER n_U_half2_gc0,n_U_half2_gc1,n_U_half2_gc2
+
+      INTEGER n_N_gc0,n_N_gc1,n_N_gc2
+
+      REAL dx(0:NDIM-1)
+
+      REAL U_half00(
+     &     FACE3d0VECG(side0_ifirst,side0_ilast,n_U_half0_gc)
+     &     )
+      REAL U_half01(
+     &     FACE3d1VECG(side0_ifirst,side0_ilast,n_U_half0_gc)
+     &     )
+      REAL U_half02(
+     &     FACE3d2VECG(side0_ifirst,side0_ilast,n_U_half0_gc)
+     &     )
+      REAL U_half10(
+     &     FACE3d0VECG(side1_ifirst,side1_ilast,n_U_half1_gc)
+     &     )
+      REAL U_half11(
+     &     FACE3d1VECG(side1_ifirst,side1_ilast,n_U_half1_gc)
+     &     )
+      REAL U_half12(
+     &     FACE3d2VECG(side1_ifirst,side1_ilast,n_U_half1_gc)
+     &     )
+      REAL U_half20(
+     &     FACE3d0VECG(side2_ifirst,side2_ilast,n_U_half2_gc)
+     &     )
+      REAL U_half21(
+     &     FACE3d1VECG(side2_ifirst,side2_ilast,n_U_half2_gc)
+     &     )
+      REAL U_half22(
+     &     FACE3d2VECG(side2_ifirst,side2_ilast,n_U_half2_gc)
+     &     )
+c
+c     Output.
+c
+      REAL N0(
+     &     CELL3dVECG(side0_ifirst,side0_ilast,n_N_gc)
+     &     )
+      REAL N1(
+     &     CELL3dVECG(side1_ifirst,side1_ilast,n_N_gc)
+     &     )
+      REAL N2(
+     &     CELL3dVECG(side2_ifirst,side2_ilast,n_N_gc)
+     &     )
+c
+c     Local variables.
+c
+      INTEGER ic0,ic1,ic2
+      INTEGER jc0,jc1,jc2
+      INTEGER t0,t1,t2
+      REAL wc,wa
+      REAL ulo,uhi,qlo,qhi
+      REAL D
+c
+c     Determine the weights of the conservative and advective forms.
+c
+      if (diff_form .eq. 0) then
+         wc = 1.d0
+         wa = 0.d0
+      elseif (diff_form .eq. 1) then
+         wc = 0.d0
+         wa = 1.d0
+      else
+         wc = 0.5d0
+         wa = 0.5d0
+      endif
+
+      t0 = max(tile0,1)
+      t1 = max(tile1,1)
+      t2 = max(tile2,1)
+c
+c     Compute N0.
+c
+      do jc2 = side0_ifirst2,side0_ilast2,t2
+      do jc1 = side0_ifirst1,side0_ilast1,t1
+      do jc0 = side0_ifirst0,side0_ilast0,t0
+         do ic2 = jc2,min(jc2+t2-1,side0_ilast2)
+            do ic1 = jc1,min(jc1+t1-1,side0_ilast1)
+               do ic0 = jc0,min(jc0+t0-1,side0_ilast0)
+                  ulo = U_half00(ic0  ,ic1,ic2)
+                  uhi = U_half00(ic0+1,ic1,ic2)
+                  D = (wc*(uhi*uhi-ulo*ulo) +
+     &                 wa*0.5d0*(uhi+ulo)*(uhi-ulo))/dx(0)
+
+                  ulo = U_half10(ic0,ic1  ,ic2)
+                  uhi = U_half10(ic0,ic1+1,ic2)
+                  qlo = U_half01(ic1  ,ic2,ic0)
+                  qhi = U_half01(ic1+1,ic2,ic0)
+                  D = D + (wc*(uhi*qhi-ulo*qlo) +
+     &                 wa*0.5d0*(uhi+ulo)*(qhi-qlo))/dx(1)
+
+                  ulo = U_half20(ic0,ic1,ic2  )
+                  uhi = U_half20(ic0,ic1,ic2+1)
+                  qlo = U_half02(ic2  ,ic0,ic1)
+                  qhi = U_half02(ic2+1,ic0,ic1)
+                  D = D + (wc*(uhi*qhi-ulo*qlo) +
+     &                 wa*0.5d0*(uhi+ulo)*(qhi-qlo))/dx(2)
+
+                  N0(ic0,ic1,ic2) = D
+               enddo
+            enddo
+         enddo
+      enddo
+      enddo
+      enddo
+c
+c     Compute N1.
+c
+      do jc2 = side1_ifirst2,side1_ilast2,t2
+      do jc1 = side1_ifirst1,side1_ilast1,t1
+      do jc0 = side1_ifirst0,side1_ilast0,t0
+         do ic2 = jc2,min(jc2+t2-1,side1_ilast2)
+            do ic1 = jc1,min(jc1+t1-1,side1_ilast1)
+               do ic0 = jc0,min(jc0+t0-1,side1_ilast0)
+                  ulo = U_half01(ic1,ic2,ic0  )
+                  uhi = U_half01(ic1,ic2,ic0+1)
+                  qlo = U_half10(ic0  ,ic1,ic2)
+                  qhi = U_half10(ic0+1,ic1,ic2)
+                  D = (wc*(uhi*qhi-ulo*qlo) +
+     &                 wa*0.5d0*(uhi+ulo)*(qhi-qlo))/dx(0)
+
+                  ulo = U_half11(ic1  ,ic2,ic0)
+                  uhi = U_half11(ic1+1,ic2,ic0)
+                  D = D + (wc*(uhi*uhi-ulo*ulo) +
+     &                 wa*0.5d0*(uhi+ulo)*(uhi-ulo))/dx(1)
+
+                  ulo = U_half21(ic1,ic2  ,ic0)
+                  uhi = U_half21(ic1,ic2+1,ic0)
+                  qlo = U_half12(ic2  ,ic0,ic1)
+                  qhi = U_half12(ic2+1,ic0,ic1)
+                  D = D + (wc*(uhi*qhi-ulo*qlo) +
+     &                 wa*0.5d0*(uhi+ulo)*(qhi-qlo))/dx(2)
+
+                  N1(ic0,ic1,ic2) = D
+               enddo
+            enddo
+         enddo
+      enddo
+      enddo
+      enddo
+c
+c     Compute N2.
+c
+      do jc2 = side2_ifirst2,side2_ilast2,t2
+      do jc1 = side2_ifirst1,side2_ilast1,t1
+      do jc0 = side2_ifirst0,side2_ilast0,t0
+         do ic2 = jc2,min(jc2+t2-1,side2_ilast2)
+            do ic1 = jc1,min(jc1+t1-1,side2_ilast1)
+               do ic0 = jc0,min(jc0+t0-1,side2_ilast0)
+                  ulo = U_half02(ic2,ic0  ,ic1)
+                  uhi = U_half02(ic2,ic0+1,ic1)
+                  qlo = U_half20(ic0  ,ic1,ic2)
+                  qhi = U_half20(ic0+1,ic1,ic2)
+                  D = (wc*(uhi*qhi-ulo*qlo) +
+     &                 wa*0.5d0*(uhi+ulo)*(qhi-qlo))/dx(0)
+
+                  ulo = U_half12(ic2,ic0,ic1  )
+                  uhi = U_half12(ic2,ic0,ic1+1)
+                  qlo = U_half21(ic1  ,ic2,ic0)
+                  qhi = U_half21(ic1+1,ic2,ic0)
+                  D = D + (wc*(uhi*qhi-ulo*qlo) +
+     &                 wa*0.5d0*(uhi+ulo)*(qhi-qlo))/dx(1)
+
+                  ulo = U_half22(ic2  ,ic0,ic1)
+                  uhi = U_half22(ic2+1,ic0,ic1)
+                  D = D + (wc*(uhi*uhi-ulo*ulo) +
+     &                 wa*0.5d0*(uhi+ulo)*(uhi-ulo))/dx(2)
+
+                  N2(ic0,ic1,ic2) = D
+               enddo
+            enddo
+         enddo
+      enddo
+      enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
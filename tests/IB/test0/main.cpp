@@ -0,0 +1,248 @@
+// Copyright (c) 2002-2014, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBImplicitStaggeredHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/PETScVecUtilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// IB-4 interpolation function, as used by IBImplicitStaggeredHierarchyIntegrator
+// to build the sparse coupling operators.
+static void
+ib_4_interp_fcn(const double r, double* const w)
+{
+    const double q = sqrt(-7.0 + 12.0 * r - 4.0 * r * r);
+    w[0] = 0.125 * (5.0 - 2.0 * r - q);
+    w[1] = 0.125 * (5.0 - 2.0 * r + q);
+    w[2] = 0.125 * (-1.0 + 2.0 * r + q);
+    w[3] = 0.125 * (-1.0 + 2.0 * r - q);
+    return;
+} // ib_4_interp_fcn
+static const int ib_4_interp_stencil = 4;
+
+/*******************************************************************************
+ * Compare the sparse Lagrangian-Eulerian spreading operator with the          *
+ * matrix-free spreading operator.  Run in parallel, e.g.:                     *
+ *                                                                             *
+ *    mpiexec -np 2 ./main2d input2d                                           *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool test_passed = true;
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSStaggeredHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBImplicitStaggeredHierarchyIntegrator("IBHierarchyIntegrator",
+                                                       app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                                       ib_method_ops,
+                                                       navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        Pointer<CartGridFunction> p_init = new muParserCartGridFunction(
+            "p_init", app_initializer->getComponentDatabase("PressureInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerPressureInitialConditions(p_init);
+
+        // Register the Eulerian force and DOF index variables used by the test.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("test");
+        const IntVector<NDIM> ib_ghosts = ib_method_ops->getMinimumGhostCellWidth();
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        const int f_mf_idx = var_db->registerVariableAndContext(f_var, ctx, ib_ghosts);
+        const int f_sparse_idx = var_db->registerClonedPatchDataIndex(f_var, f_mf_idx);
+        Pointer<SideVariable<NDIM, int> > dof_index_var = new SideVariable<NDIM, int>("dof_index");
+        const int dof_index_idx = var_db->registerVariableAndContext(dof_index_var, ctx, ib_ghosts);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // The sparse operators act only on a uniform grid.
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+        level->allocatePatchData(f_mf_idx);
+        level->allocatePatchData(f_sparse_idx);
+        level->allocatePatchData(dof_index_idx);
+        pout << "number of patches on level " << finest_ln << ": " << level->getNumberOfPatches() << "\n"
+             << "number of processors:      " << SAMRAI_MPI::getNodes() << "\n";
+
+        // Setup the linearized Lagrangian force for the current configuration
+        // of the structure.
+        const double current_time = time_integrator->getIntegratorTime();
+        const double new_time = current_time + time_integrator->getMaximumTimeStepSize();
+        const double half_time = current_time + 0.5 * (new_time - current_time);
+        ib_method_ops->preprocessIntegrateData(current_time, new_time, /*num_cycles*/ 1);
+        ib_method_ops->updateFixedLEOperators();
+        PetscErrorCode ierr;
+        Vec X_vec;
+        ib_method_ops->createSolverVecs(&X_vec, NULL);
+        ib_method_ops->setupSolverVecs(&X_vec, NULL);
+        ib_method_ops->setLinearizedPosition(X_vec, half_time);
+        ib_method_ops->computeLinearizedLagrangianForce(X_vec, half_time);
+
+        // Spread the force with the matrix-free operator.
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, finest_ln, finest_ln);
+        hier_sc_data_ops.setToScalar(f_mf_idx, 0.0, /*interior_only*/ false);
+        ib_method_ops->spreadLinearizedForce(
+            f_mf_idx, NULL, std::vector<Pointer<RefineSchedule<NDIM> > >(finest_ln + 1), half_time);
+
+        // Spread the force with the sparse operator, and copy the result back
+        // to the patch data in the same way as the time integrator.
+        std::vector<int> num_dofs_per_proc;
+        PETScVecUtilities::constructPatchLevelDOFIndices(num_dofs_per_proc, dof_index_idx, level);
+        ib_method_ops->constructLinearizedLEOperators(
+            ib_4_interp_fcn, ib_4_interp_stencil, num_dofs_per_proc, dof_index_idx, half_time);
+        Vec f_vec;
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, num_dofs_per_proc[SAMRAI_MPI::getRank()], PETSC_DETERMINE, &f_vec);
+        IBTK_CHKERRQ(ierr);
+        Pointer<RefineSchedule<NDIM> > data_synch_sched =
+            PETScVecUtilities::constructDataSynchSchedule(f_sparse_idx, level);
+        Pointer<RefineSchedule<NDIM> > ghost_fill_sched =
+            PETScVecUtilities::constructGhostFillSchedule(f_sparse_idx, level);
+        hier_sc_data_ops.setToScalar(f_sparse_idx, 0.0, /*interior_only*/ false);
+        ib_method_ops->spreadLinearizedForce(f_vec);
+        PETScVecUtilities::copyFromPatchLevelVec(
+            f_vec, f_sparse_idx, dof_index_idx, level, data_synch_sched, ghost_fill_sched);
+
+        // Compare the two results on the patch interiors, including the
+        // side-centered values that are shared by neighboring patches.
+        HierarchyMathOps hier_math_ops("HierarchyMathOps", patch_hierarchy);
+        hier_math_ops.setPatchHierarchy(patch_hierarchy);
+        hier_math_ops.resetLevels(finest_ln, finest_ln);
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const double f_norm = hier_sc_data_ops.maxNorm(f_mf_idx, wgt_sc_idx);
+        hier_sc_data_ops.subtract(f_sparse_idx, f_sparse_idx, f_mf_idx);
+        const double e_norm = hier_sc_data_ops.maxNorm(f_sparse_idx, wgt_sc_idx);
+        const double rel_err = f_norm > 0.0 ? e_norm / f_norm : e_norm;
+        pout << "max-norm of matrix-free spread force:          " << f_norm << "\n"
+             << "max-norm of (sparse - matrix-free) spread force: " << e_norm << "\n"
+             << "relative error:                                 " << rel_err << "\n";
+        test_passed = f_norm > 0.0 && rel_err < 1.0e-10;
+        pout << (test_passed ? "PASSED" : "FAILED") << "\n";
+
+        // Cleanup.
+        ierr = VecDestroy(&f_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&X_vec);
+        IBTK_CHKERRQ(ierr);
+        ib_method_ops->postprocessIntegrateData(current_time, new_time, /*num_cycles*/ 1);
+        level->deallocatePatchData(f_mf_idx);
+        level->deallocatePatchData(f_sparse_idx);
+        level->deallocatePatchData(dof_index_idx);
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return test_passed ? 0 : 1;
+} // main